@@ -0,0 +1,3 @@
+Step: 1
+p(1) p(2) p(3) q(1) q(10) q(2) q(20) q(3) q(30)
+SAT
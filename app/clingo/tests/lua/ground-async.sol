@@ -0,0 +1,5 @@
+Step: 1
+a(1) b(1)
+Step: 2
+a(1) b(1) e
+SAT
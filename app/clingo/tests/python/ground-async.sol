@@ -0,0 +1,7 @@
+Step: 1
+a(1) b(1)
+Step: 2
+a(1) b(1)
+Step: 3
+a(1) b(1) e
+SAT
@@ -0,0 +1,3 @@
+Step: 1
+arg("a",None,a) arg(1,1,None) arg(2,2,None) atom(p(1),1) atom(p(2),1) atom(q("a"),1) name(p) name(p) name(q) p(1) p(2) size(3,8)
+UNKNOWN
@@ -541,6 +541,15 @@ typedef struct clingo_symbolic_atoms clingo_symbolic_atoms_t;
 //! ::clingo_control_cleanup(), and functions that modify the underlying
 //! non-ground program.
 typedef uint64_t clingo_symbolic_atom_iterator_t;
+//! Flags describing symbolic atoms in bulk exports.
+//!
+//! @see clingo_symbolic_atoms_export()
+enum clingo_symbolic_atom_flag_e {
+    clingo_symbolic_atom_flag_fact     = 1, //!< The atom is a fact.
+    clingo_symbolic_atom_flag_external = 2  //!< The atom is external.
+};
+//! Corresponding type to ::clingo_symbolic_atom_flag_e.
+typedef unsigned clingo_symbolic_atom_flags_t;
 //! Get the number of different atoms occurring in a logic program.
 //!
 //! @param[in] atoms the target
@@ -649,6 +658,32 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_symbolic_atoms_next(clingo_symbolic_atoms_
 //! sequence
 //! @return whether the call was successful
 CLINGO_VISIBILITY_DEFAULT bool clingo_symbolic_atoms_is_valid(clingo_symbolic_atoms_t *atoms, clingo_symbolic_atom_iterator_t iterator, bool *valid);
+//! Get the number of atoms exported by clingo_symbolic_atoms_export().
+//!
+//! @param[in] atoms the target
+//! @param[in] signature optional signature
+//! @param[out] size the number of atoms
+//! @return whether the call was successful
+CLINGO_VISIBILITY_DEFAULT bool clingo_symbolic_atoms_export_size(clingo_symbolic_atoms_t *atoms, clingo_signature_t const *signature, size_t *size);
+//! Export all symbolic atoms optionally restricted to a given signature in
+//! one call.
+//!
+//! The atoms are stored in the same order as they are visited when iterating
+//! with clingo_symbolic_atoms_begin(). Any of the output arrays can be NULL,
+//! in which case the corresponding information is not exported.
+//!
+//! @param[in] atoms the target
+//! @param[in] signature optional signature
+//! @param[out] symbols the symbols of the atoms
+//! @param[out] literals the program literals of the atoms
+//! @param[out] flags the flags of the atoms (see ::clingo_symbolic_atom_flag_e)
+//! @param[in] size the size of the output arrays
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_runtime if the size is too small
+//!
+//! @see clingo_symbolic_atoms_export_size()
+CLINGO_VISIBILITY_DEFAULT bool clingo_symbolic_atoms_export(clingo_symbolic_atoms_t *atoms, clingo_signature_t const *signature, clingo_symbol_t *symbols, clingo_literal_t *literals, clingo_symbolic_atom_flags_t *flags, size_t size);
 
 //! @}
 
@@ -960,6 +995,9 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_model_type(clingo_model_t *model, clingo_m
 CLINGO_VISIBILITY_DEFAULT bool clingo_model_number(clingo_model_t *model, uint64_t *number);
 //! Get the number of symbols of the selected types in the model.
 //!
+//! The selected symbols are computed once and reused by a subsequent call to
+//! clingo_model_symbols() with the same selection.
+//!
 //! @param[in] model the target
 //! @param[in] show which symbols to select
 //! @param[out] size the number symbols
@@ -1204,6 +1242,68 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_solve_handle_close(clingo_solve_handle_t *
 
 //! @}
 
+// {{{1 ground handle
+
+//! @defgroup GroundHandle Grounding
+//! Interact with a running grounding process.
+//!
+//! A ::clingo_ground_handle_t object is returned by ::clingo_control_ground_async().
+//! It can be used to wait for, poll the progress of, or cancel grounding.
+//! @ingroup Control
+
+//! @addtogroup GroundHandle
+//! @{
+
+//! Handle to an asynchronous ground call.
+//!
+//! @see clingo_control_ground_async()
+typedef struct clingo_ground_handle clingo_ground_handle_t;
+
+//! Wait for grounding to finish.
+//!
+//! @param[in] handle the target
+//! @param[out] completed whether grounding finished without being cancelled
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_runtime if grounding fails
+//! - error code of ground callback
+CLINGO_VISIBILITY_DEFAULT bool clingo_ground_handle_get(clingo_ground_handle_t *handle, bool *completed);
+//! Wait for the specified amount of time to check if grounding has finished.
+//!
+//! If the time is set to zero, this function can be used to poll if grounding is still active.
+//! If the time is negative, the function blocks until grounding is finished.
+//!
+//! @param[in] handle the target
+//! @param[in] timeout the maximum time to wait
+//! @param[out] result whether grounding has finished
+CLINGO_VISIBILITY_DEFAULT void clingo_ground_handle_wait(clingo_ground_handle_t *handle, double timeout, bool *result);
+//! Get the number of rule instances grounded so far.
+//!
+//! This function can be called while grounding is running.
+//!
+//! @param[in] handle the target
+//! @param[out] progress the number of rule instances
+CLINGO_VISIBILITY_DEFAULT void clingo_ground_handle_progress(clingo_ground_handle_t *handle, uint64_t *progress);
+//! Stop grounding at the next cancellation point and block until done.
+//!
+//! @note The current step is finished with the rules grounded so far.
+//! Afterward, the control object can be used again.
+//!
+//! @param[in] handle the target
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+CLINGO_VISIBILITY_DEFAULT bool clingo_ground_handle_cancel(clingo_ground_handle_t *handle);
+//! Stops grounding and releases the handle.
+//!
+//! Blocks until grounding is stopped (as if an implicit cancel was called before the handle is released).
+//!
+//! @param[in] handle the target
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+CLINGO_VISIBILITY_DEFAULT bool clingo_ground_handle_close(clingo_ground_handle_t *handle);
+
+//! @}
+
 // {{{1 propagator
 
 //! @example propagator.c
@@ -3067,6 +3167,22 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_control_load(clingo_control_t *control, ch
 //! - ::clingo_error_runtime if parsing fails
 CLINGO_VISIBILITY_DEFAULT bool clingo_control_add(clingo_control_t *control, char const *name, char const * const * parameters, size_t parameters_size, char const *program);
 
+//! Extend the logic program with the given facts.
+//!
+//! The facts are added to the program block of form: <tt>\#program name.</tt>
+//! Unlike facts added with ::clingo_control_add(), the given symbols are
+//! neither parsed nor subject to constant definitions.
+//! They become part of the program when the block is grounded.
+//!
+//! @param[in] control the target
+//! @param[in] name name of the program block
+//! @param[in] facts the facts to add
+//! @param[in] size the number of facts
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//! - ::clingo_error_runtime if a symbol is not a function
+CLINGO_VISIBILITY_DEFAULT bool clingo_control_add_facts(clingo_control_t *control, char const *name, clingo_symbol_t const *facts, size_t size);
+
 //! Ground the selected @link ::clingo_part parts @endlink of the current (non-ground) logic program.
 //!
 //! After grounding, logic programs can be solved with ::clingo_control_solve().
@@ -3086,6 +3202,29 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_control_add(clingo_control_t *control, cha
 //!
 //! @see clingo_part
 CLINGO_VISIBILITY_DEFAULT bool clingo_control_ground(clingo_control_t *control, clingo_part_t const *parts, size_t parts_size, clingo_ground_callback_t ground_callback, void *ground_callback_data);
+//! Ground the selected @link ::clingo_part parts @endlink of the current (non-ground) logic program in the background.
+//!
+//! The function returns immediately; the returned handle can be used to wait
+//! for, poll, or cancel grounding.  The ground callback is called from
+//! the grounding thread.
+//!
+//! @attention Other functions of the control object fail with
+//! ::clingo_error_runtime until grounding has finished (see
+//! clingo_ground_handle_wait()).  Freeing the control object stops grounding;
+//! the handle still has to be closed afterward.
+//!
+//! @param[in] control the target
+//! @param[in] parts array of parts to ground
+//! @param[in] parts_size size of the parts array
+//! @param[in] ground_callback callback to implement external functions
+//! @param[in] ground_callback_data user data for ground_callback
+//! @param[out] handle handle to the running ground call
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//!
+//! @see clingo_control_ground()
+//! @see clingo_ground_handle_get()
+CLINGO_VISIBILITY_DEFAULT bool clingo_control_ground_async(clingo_control_t *control, clingo_part_t const *parts, size_t parts_size, clingo_ground_callback_t ground_callback, void *ground_callback_data, clingo_ground_handle_t **handle);
 
 //! @}
 
@@ -3119,6 +3258,25 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_control_solve(clingo_control_t *control, c
 //! @return whether the call was successful; might set one of the following error codes:
 //! - ::clingo_error_bad_alloc
 CLINGO_VISIBILITY_DEFAULT bool clingo_control_cleanup(clingo_control_t *control);
+//! Clean up the domains like ::clingo_control_cleanup() and additionally
+//! forget all atoms introduced in a range of grounding steps.
+//!
+//! Each call to ::clingo_control_ground() is one grounding step; the first
+//! one has number zero.  Forgotten atoms are removed from the domains, their
+//! indices, and the output tables.  This is useful to keep memory usage
+//! bounded when solving problems with an unbounded horizon, where only a
+//! window of recent steps is referenced again.
+//!
+//! @note The caller has to ensure that atoms of the forgotten steps are
+//! never used again in later grounding steps.  Forgetting has no effect if
+//! the program contains aggregates, conditional literals, or theory atoms.
+//!
+//! @param[in] control the target
+//! @param[in] begin the first step to forget
+//! @param[in] end the step after the last step to forget
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+CLINGO_VISIBILITY_DEFAULT bool clingo_control_forget_steps(clingo_control_t *control, unsigned begin, unsigned end);
 //! Assign a truth value to an external atom.
 //!
 //! If the atom does not exist or is not external, this is a noop.
@@ -3265,6 +3423,24 @@ CLINGO_VISIBILITY_DEFAULT bool clingo_control_theory_atoms(clingo_control_t *con
 //! @param[in] data user data passed to the observer functions
 //! @return whether the call was successful
 CLINGO_VISIBILITY_DEFAULT bool clingo_control_register_observer(clingo_control_t *control, clingo_ground_program_observer_t const *observer, bool replace, void *data);
+//! Reify the ground program of the control object into facts of another control object.
+//!
+//! At the end of each step, the reified program is added to the program block
+//! of form <tt>\#program name.</tt> of the target as if passed to ::clingo_control_add_facts().
+//! The facts are created directly as symbols; they are not printed and parsed again.
+//!
+//! @param[in] control the control object whose ground program is reified
+//! @param[in] target the control object receiving the facts
+//! @param[in] name name of the program block
+//! @param[in] calculate_sccs whether to add facts for strongly connected components
+//! @param[in] reify_steps whether to add step numbers to the facts
+//! @param[in] replace just pass the grounding to the reifier but not the solver
+//! @return whether the call was successful; might set one of the following error codes:
+//! - ::clingo_error_bad_alloc
+//!
+//! @note The target must outlive the control object.
+//! @see clingo_control_register_observer()
+CLINGO_VISIBILITY_DEFAULT bool clingo_control_register_reifier(clingo_control_t *control, clingo_control_t *target, char const *name, bool calculate_sccs, bool reify_steps, bool replace);
 //! @}
 
 //! @name Program Modification Functions
@@ -562,6 +562,24 @@ public:
     clingo_symbolic_atom_iterator_t to_c() const { return range_; }
 };
 
+class SymbolicAtomFlags {
+public:
+    enum Type : clingo_symbolic_atom_flags_t {
+        Fact     = clingo_symbolic_atom_flag_fact,
+        External = clingo_symbolic_atom_flag_external
+    };
+    SymbolicAtomFlags(clingo_symbolic_atom_flags_t flags) : flags_(flags) { }
+    operator clingo_symbolic_atom_flags_t() const { return flags_; }
+private:
+    clingo_symbolic_atom_flags_t flags_;
+};
+
+struct SymbolicAtomExport {
+    std::vector<Symbol> symbols;
+    std::vector<literal_t> literals;
+    std::vector<clingo_symbolic_atom_flags_t> flags;
+};
+
 class SymbolicAtoms {
 public:
     explicit SymbolicAtoms(clingo_symbolic_atoms_t *atoms)
@@ -572,9 +590,12 @@ public:
     SymbolicAtomIterator find(Symbol atom) const;
     std::vector<Signature> signatures() const;
     size_t length() const;
+    SymbolicAtomExport export_atoms() const;
+    SymbolicAtomExport export_atoms(Signature sig) const;
     clingo_symbolic_atoms_t* to_c() const { return atoms_; }
     SymbolicAtom operator[](Symbol atom) { return *find(atom); }
 private:
+    SymbolicAtomExport export_atoms(clingo_signature_t const *sig) const;
     clingo_symbolic_atoms_t *atoms_;
 };
 
@@ -1151,6 +1172,26 @@ private:
     Detail::AssignOnce *exception_;
 };
 
+class GroundHandle {
+public:
+    GroundHandle();
+    explicit GroundHandle(clingo_ground_handle_t *handle, Detail::AssignOnce &ptr);
+    GroundHandle(GroundHandle &&handle);
+    GroundHandle(GroundHandle const &) = delete;
+    GroundHandle &operator=(GroundHandle &&handle);
+    GroundHandle &operator=(GroundHandle const &) = delete;
+    clingo_ground_handle_t *to_c() const { return handle_; }
+    void wait();
+    bool wait(double timeout);
+    bool get();
+    uint64_t progress() const;
+    void cancel();
+    ~GroundHandle();
+private:
+    clingo_ground_handle_t *handle_;
+    Detail::AssignOnce *exception_;
+};
+
 class ModelIterator : public std::iterator<Model, std::input_iterator_tag> {
 public:
     explicit ModelIterator(SolveHandle &iter)
@@ -2068,7 +2109,9 @@ public:
     Control &operator=(Control const &c) = delete;
     ~Control() noexcept;
     void add(char const *name, StringSpan params, char const *part);
+    void add_facts(char const *name, SymbolSpan facts);
     void ground(PartSpan parts, GroundCallback cb = nullptr);
+    GroundHandle ground_async(PartSpan parts, GroundCallback cb = nullptr);
     SolveHandle solve(SymbolicLiteralSpan assumptions = {}, SolveEventHandler *handler = nullptr, bool asynchronous = false, bool yield = true);
     void assign_external(Symbol atom, TruthValue value);
     void release_external(Symbol atom);
@@ -2076,7 +2119,9 @@ public:
     TheoryAtoms theory_atoms() const;
     void register_propagator(Propagator &propagator, bool sequential = false);
     void register_observer(GroundProgramObserver &observer, bool replace = false);
+    void register_reifier(Control &target, char const *name, bool calculate_sccs = false, bool reify_steps = false, bool replace = false);
     void cleanup();
+    void forget_steps(unsigned begin, unsigned end);
     bool has_const(char const *name) const;
     Symbol get_const(char const *name) const;
     void interrupt() noexcept;
@@ -2427,6 +2472,25 @@ inline size_t SymbolicAtoms::length() const {
     return ret;
 }
 
+inline SymbolicAtomExport SymbolicAtoms::export_atoms(clingo_signature_t const *sig) const {
+    size_t n;
+    Detail::handle_error(clingo_symbolic_atoms_export_size(atoms_, sig, &n));
+    SymbolicAtomExport ret;
+    ret.symbols.resize(n, Number(0));
+    ret.literals.resize(n);
+    ret.flags.resize(n);
+    Detail::handle_error(clingo_symbolic_atoms_export(atoms_, sig, reinterpret_cast<clingo_symbol_t *>(ret.symbols.data()), ret.literals.data(), ret.flags.data(), n));
+    return ret;
+}
+
+inline SymbolicAtomExport SymbolicAtoms::export_atoms() const {
+    return export_atoms(nullptr);
+}
+
+inline SymbolicAtomExport SymbolicAtoms::export_atoms(Signature sig) const {
+    return export_atoms(&sig.to_c());
+}
+
 // {{{2 theory atoms
 
 inline TheoryTermType TheoryTerm::type() const {
@@ -2842,6 +2906,55 @@ inline SolveHandle::~SolveHandle() {
     if (iter_) { Detail::handle_error(clingo_solve_handle_close(iter_), *exception_); }
 }
 
+// {{{2 ground handle
+
+inline GroundHandle::GroundHandle()
+: handle_(nullptr)
+, exception_(nullptr) { }
+
+inline GroundHandle::GroundHandle(clingo_ground_handle_t *handle, Detail::AssignOnce &ptr)
+: handle_(handle)
+, exception_(&ptr) { }
+
+inline GroundHandle::GroundHandle(GroundHandle &&handle)
+: GroundHandle() { *this = std::move(handle); }
+
+inline GroundHandle &GroundHandle::operator=(GroundHandle &&handle) {
+    std::swap(handle_, handle.handle_);
+    std::swap(exception_, handle.exception_);
+    return *this;
+}
+
+inline void GroundHandle::wait() {
+    (void)wait(-1);
+}
+
+inline bool GroundHandle::wait(double timeout) {
+    bool res = true;
+    clingo_ground_handle_wait(handle_, timeout, &res);
+    return res;
+}
+
+inline bool GroundHandle::get() {
+    bool ret = false;
+    Detail::handle_error(clingo_ground_handle_get(handle_, &ret), *exception_);
+    return ret;
+}
+
+inline uint64_t GroundHandle::progress() const {
+    uint64_t ret = 0;
+    clingo_ground_handle_progress(handle_, &ret);
+    return ret;
+}
+
+inline void GroundHandle::cancel() {
+    Detail::handle_error(clingo_ground_handle_cancel(handle_), *exception_);
+}
+
+inline GroundHandle::~GroundHandle() {
+    if (handle_) { Detail::handle_error(clingo_ground_handle_close(handle_), *exception_); }
+}
+
 // {{{2 backend
 
 inline void Backend::rule(bool choice, AtomSpan head, LiteralSpan body) {
@@ -3672,6 +3785,7 @@ struct Control::Impl {
     operator clingo_control_t *() { return ctl; }
     clingo_control_t *ctl;
     SolveEventHandler *handler;
+    GroundCallback ground_callback;
     Detail::AssignOnce ptr;
     Logger logger;
     std::forward_list<std::pair<Propagator&, Detail::AssignOnce&>> propagators_;
@@ -3711,6 +3825,10 @@ inline void Control::add(char const *name, StringSpan params, char const *part)
     Detail::handle_error(clingo_control_add(*impl_, name, params.begin(), params.size(), part));
 }
 
+inline void Control::add_facts(char const *name, SymbolSpan facts) {
+    Detail::handle_error(clingo_control_add_facts(*impl_, name, reinterpret_cast<clingo_symbol_t const *>(facts.begin()), facts.size()));
+}
+
 inline void Control::ground(PartSpan parts, GroundCallback cb) {
     using Data = std::pair<GroundCallback&, Detail::AssignOnce&>;
     Data data(cb, impl_->ptr);
@@ -3733,6 +3851,27 @@ inline void Control::ground(PartSpan parts, GroundCallback cb) {
         }, &data), data.second);
 }
 
+inline GroundHandle Control::ground_async(PartSpan parts, GroundCallback cb) {
+    clingo_ground_handle_t *handle;
+    impl_->ground_callback = std::move(cb);
+    impl_->ptr.reset();
+    clingo_ground_callback_t on_call = [](clingo_location_t const *loc, char const *name, clingo_symbol_t const *args, size_t n, void *data, clingo_symbol_callback_t cb, void *cbdata) -> bool {
+        Impl &d = *static_cast<Impl*>(data);
+        CLINGO_CALLBACK_TRY {
+            struct Ret : std::exception { };
+            try {
+                d.ground_callback(Location(*loc), name, {reinterpret_cast<Symbol const *>(args), n}, [cb, cbdata](SymbolSpan symret) {
+                    if (!cb(reinterpret_cast<clingo_symbol_t const *>(symret.begin()), symret.size(), cbdata)) { throw Ret(); }
+                });
+            }
+            catch (Ret const &) { return false; }
+        }
+        CLINGO_CALLBACK_CATCH(d.ptr);
+    };
+    Detail::handle_error(clingo_control_ground_async(*impl_, reinterpret_cast<clingo_part_t const *>(parts.begin()), parts.size(), impl_->ground_callback ? on_call : nullptr, impl_, &handle), impl_->ptr);
+    return GroundHandle{handle, impl_->ptr};
+}
+
 inline clingo_control_t *Control::to_c() const { return *impl_; }
 
 inline SolveHandle Control::solve(SymbolicLiteralSpan assumptions, SolveEventHandler *handler, bool asynchronous, bool yield) {
@@ -3998,10 +4137,18 @@ inline void Control::register_observer(GroundProgramObserver &observer, bool rep
     Detail::handle_error(clingo_control_register_observer(*impl_, &g_observer, replace, &impl_->observers_.front()));
 }
 
+inline void Control::register_reifier(Control &target, char const *name, bool calculate_sccs, bool reify_steps, bool replace) {
+    Detail::handle_error(clingo_control_register_reifier(*impl_, *target.impl_, name, calculate_sccs, reify_steps, replace));
+}
+
 inline void Control::cleanup() {
     Detail::handle_error(clingo_control_cleanup(*impl_));
 }
 
+inline void Control::forget_steps(unsigned begin, unsigned end) {
+    Detail::handle_error(clingo_control_forget_steps(*impl_, begin, end));
+}
+
 inline bool Control::has_const(char const *name) const {
     bool ret;
     Detail::handle_error(clingo_control_has_const(*impl_, name, &ret));
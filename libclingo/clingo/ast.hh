@@ -157,6 +157,7 @@ private:
     TheoryTermUid theorytermarr_(Location const &loc, TheoryOptermVecUid args, clingo_ast_theory_term_type_t type);
     clingo_ast_theory_unparsed_term_element_t opterm_(TheoryOpVecUid ops, TheoryTermUid term);
     clingo_ast_theory_term_t opterm_(Location const &loc, TheoryOptermUid opterm);
+    void *allocate_(size_t size);
     template <class T>
     T *create_();
     template <class T>
@@ -225,8 +226,12 @@ private:
     TheoryTermDefs      theoryTermDefs_;
     TheoryAtomDefs      theoryAtomDefs_;
     TheoryDefVecs       theoryDefVecs_;
-    std::vector<void *> data_;
-    std::vector<void *> arrdata_;
+    // memory for the AST nodes of the current statement
+    // (chunks are kept and reused for subsequent statements)
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    std::vector<std::unique_ptr<char[]>> large_;
+    size_t chunk_ = 0;
+    size_t offset_ = 0;
 };
 
 void parseStatement(INongroundProgramBuilder &prg, Logger &log, clingo_ast_statement_t const &stm);
@@ -29,6 +29,7 @@
 #include <clingo/scripts.hh>
 #include <clingo/ast.hh>
 #include <gringo/output/output.hh>
+#include <gringo/output/backends.hh>
 #include <gringo/input/program.hh>
 #include <gringo/input/programbuilder.hh>
 #include <gringo/input/nongroundparser.hh>
@@ -40,16 +41,23 @@
 #include <clasp/cli/clasp_options.h>
 #include <potassco/application.h>
 #include <potassco/string_convert.h>
+#include <condition_variable>
 #include <mutex>
+#if CLASP_HAS_THREADS
+#include <thread>
+#endif
 
 namespace Gringo {
 
 // {{{1 declaration of ClaspAPIBackend
 
-class ClingoControl;
+// Passes statements to a clasp logic program.
+//
+// The backend does not access the control object. This way, it can run on
+// the worker thread of a PipelinedBackend.
 class ClaspAPIBackend : public Backend {
 public:
-    ClaspAPIBackend(ClingoControl& ctl) : ctl_(ctl) { }
+    ClaspAPIBackend(Clasp::Asp::LogicProgram &prg) : prg_(prg) { }
     ClaspAPIBackend(const ClaspAPIBackend&) = delete;
     ClaspAPIBackend& operator=(const ClaspAPIBackend&) = delete;
     void initProgram(bool incremental) override;
@@ -74,8 +82,55 @@ public:
     void endStep() override;
     ~ClaspAPIBackend() noexcept override;
 private:
-    Clasp::Asp::LogicProgram *prg();
+    Potassco::StringSpan format(Symbol sym);
+    Potassco::StringSpan formatTerm(Symbol sym);
+
+    Clasp::Asp::LogicProgram &prg_;
+    // reused for formatting symbols
+    std::string buffer_;
+    // shown terms can be output several times with different conditions;
+    // their text is cached until the end of the step
+    std::unordered_map<Symbol, std::string> terms_;
+};
+
+// {{{1 declaration of ClingoControlBackend
+
+// Starts a step of the control object before passing statements on.
+//
+// The backend is called on the grounding thread. Statements are dropped if
+// the solver cannot be updated anymore.
+class ClingoControl;
+class ClingoControlBackend : public Backend {
+public:
+    ClingoControlBackend(ClingoControl& ctl, UBackend &&out) : ctl_(ctl), out_(std::move(out)) { }
+    ClingoControlBackend(const ClingoControlBackend&) = delete;
+    ClingoControlBackend& operator=(const ClingoControlBackend&) = delete;
+    void initProgram(bool incremental) override;
+    void beginStep() override;
+    void rule(Potassco::Head_t ht, const Potassco::AtomSpan& head, const Potassco::LitSpan& body) override;
+    void rule(Potassco::Head_t ht, const Potassco::AtomSpan& head, Potassco::Weight_t bound, const Potassco::WeightLitSpan& body) override;
+    void minimize(Potassco::Weight_t prio, const Potassco::WeightLitSpan& lits) override;
+    void project(const Potassco::AtomSpan& atoms) override;
+    void output(Symbol sym, Potassco::Atom_t atom) override;
+    void output(Symbol sym, Potassco::LitSpan const& condition) override;
+    void output(Symbol sym, int value, Potassco::LitSpan const& condition) override;
+    void external(Potassco::Atom_t a, Potassco::Value_t v) override;
+    void assume(const Potassco::LitSpan& lits) override;
+    void heuristic(Potassco::Atom_t a, Potassco::Heuristic_t t, int bias, unsigned prio, const Potassco::LitSpan& condition) override;
+    void acycEdge(int s, int t, const Potassco::LitSpan& condition) override;
+    void theoryTerm(Potassco::Id_t termId, int number) override;
+    void theoryTerm(Potassco::Id_t termId, const Potassco::StringSpan& name) override;
+    void theoryTerm(Potassco::Id_t termId, int cId, const Potassco::IdSpan& args) override;
+    void theoryElement(Potassco::Id_t elementId, const Potassco::IdSpan& terms, const Potassco::LitSpan& cond) override;
+    void theoryAtom(Potassco::Id_t atomOrZero, Potassco::Id_t termId, const Potassco::IdSpan& elements) override;
+    void theoryAtom(Potassco::Id_t atomOrZero, Potassco::Id_t termId, const Potassco::IdSpan& elements, Potassco::Id_t op, Potassco::Id_t rhs) override;
+    void endStep() override;
+    ~ClingoControlBackend() noexcept override;
+private:
+    bool update();
+
     ClingoControl& ctl_;
+    UBackend out_;
 };
 
 // {{{1 declaration of ClingoOptions
@@ -94,6 +149,8 @@ struct ClingoOptions {
     bool                          wNoOther              = false;
     bool                          rewriteMinimize       = false;
     bool                          keepFacts             = false;
+    unsigned                      memoLimit             = 1000000;
+    unsigned                      rewriteThreads        = 1;
     Foobar                        foobar;
 };
 
@@ -190,6 +247,7 @@ private:
 };
 
 class ClingoSolveFuture;
+class ClingoGroundFuture;
 class ClingoControl : public clingo_control, private ConfigProxy, private SymbolicAtoms {
 public:
     using StringVec        = std::vector<std::string>;
@@ -230,6 +288,8 @@ public:
     bool external(SymbolicAtomIter it) const override;
     SymbolicAtomIter next(SymbolicAtomIter it) override;
     bool valid(SymbolicAtomIter it) const override;
+    size_t exportSize(Sig const *sig) const override;
+    void exportAtoms(Sig const *sig, Symbol *atoms, Potassco::Lit_t *literals, unsigned *flags, size_t size) const override;
 
     // {{{2 ConfigProxy interface
 
@@ -246,7 +306,10 @@ public:
 
     SymbolicAtoms &getDomain() override;
     void ground(Control::GroundVec const &vec, Context *ctx) override;
+    void ground(Control::GroundVec const &vec, Context *ctx, Ground::GroundProgress *progress);
+    UGroundFuture groundAsync(Control::GroundVec const &vec, std::unique_ptr<Context> ctx) override;
     void add(std::string const &name, Gringo::StringVec const &params, std::string const &part) override;
+    void addFacts(std::string const &name, Gringo::SymSpan facts) override;
     void load(std::string const &filename) override;
     bool blocked() override;
     std::string str();
@@ -257,6 +320,7 @@ public:
     void useEnumAssumption(bool enable) override;
     bool useEnumAssumption() override;
     void cleanupDomains() override;
+    void forgetSteps(unsigned begin, unsigned end) override;
     USolveFuture solve(Assumptions &&ass, clingo_solve_mode_bitset_t mode, USolveEventHandler cb) override;
     Output::DomainData const &theory() const override { return out_->data; }
     void registerPropagator(UProp p, bool sequential) override;
@@ -265,18 +329,37 @@ public:
     Backend *backend() override;
     Potassco::Atom_t addProgramAtom() override;
     Logger &logger() override { return logger_; }
-    void beginAdd() override { parse(); }
+    void beginAdd() override {
+        checkGrounding();
+        parse();
+    }
     void add(clingo_ast_statement_t const &stm) override { Input::parseStatement(*pb_, logger_, stm); }
     void endAdd() override { defs_.init(logger_); parsed = true; }
     void registerObserver(UBackend obs, bool replace) override {
-        if (replace) { clingoMode_ = false; }
+        checkGrounding();
+        if (replace) {
+            clingoMode_ = false;
+            claspBackend_ = nullptr;
+            pipeline_ = nullptr;
+        }
         out_->registerObserver(std::move(obs), replace);
     }
 
     // }}}2
 
+    void cleanup(Id_t forgetBegin, Id_t forgetEnd);
+    // Throws if an asynchronous ground call is still running.
+    void checkGrounding();
+    // Waits until pipelined statements have been passed to clasp.
+    void sync() const;
+    // Stops asynchronous grounding and passes pipelined statements to clasp.
+    void shutdown() noexcept;
+
     std::unique_ptr<Output::OutputBase>                        out_;
+    ClaspAPIBackend                                           *claspBackend_          = nullptr;
+    Output::PipelinedBackend                                  *pipeline_              = nullptr;
     Scripts                                                   &scripts_;
+    MemoContext                                                memo_;
     Input::Program                                             prg_;
     Defines                                                    defs_;
     std::unique_ptr<Input::NongroundProgramBuilder>            pb_;
@@ -292,6 +375,7 @@ public:
     ClingoPropagatorLock                                       propLock_;
     Logger                                                     logger_;
     std::unique_ptr<SolveFuture>                               solveFuture_;
+    ClingoGroundFuture                                        *groundFuture_          = nullptr;
     bool                                                       enableEnumAssupmption_ = true;
     bool                                                       clingoMode_;
     bool                                                       verbose_               = false;
@@ -309,16 +393,24 @@ class ClingoModel : public Model {
 public:
     ClingoModel(ClingoControl &ctl, Clasp::Model const *model = nullptr)
     : ctl_(ctl), model_(model) { }
-    void reset(Clasp::Model const &m) { model_ = &m; }
+    void reset(Clasp::Model const &m) {
+        model_ = &m;
+        atmsValid_ = false;
+    }
     bool contains(Symbol atom) const override {
         auto atm = out().find(atom);
         return atm.second && atm.first->hasUid() && model_->isTrue(lp().getLiteral(atm.first->uid()));
     }
     SymSpan atoms(unsigned atomset) const override {
+        // NOTE: callers typically query the size before copying the symbols
+        if (atmsValid_ && atmsSet_ == atomset) { return Potassco::toSpan(atms_); }
+        atmsValid_ = false;
         atms_ = out().atoms(atomset, [this](unsigned uid) { return model_->isTrue(lp().getLiteral(uid)); });
         if (atomset & clingo_show_type_extra){
             ctl_.addToModel(*model_, (atomset & clingo_show_type_complement) != 0, atms_);
         }
+        atmsSet_ = atomset;
+        atmsValid_ = true;
         return Potassco::toSpan(atms_);
     }
     Int64Vec optimization() const override {
@@ -359,6 +451,8 @@ private:
     ClingoControl          &ctl_;
     Clasp::Model const     *model_;
     mutable SymVec  atms_;
+    mutable unsigned atmsSet_ = 0;
+    mutable bool atmsValid_ = false;
 };
 
 // {{{1 declaration of ClingoSolveFuture
@@ -378,6 +472,39 @@ private:
     Clasp::ClaspFacade::SolveHandle handle_;
 };
 
+// {{{1 declaration of ClingoGroundFuture
+
+#if CLASP_HAS_THREADS
+// Grounds in a separate thread.
+// The control object rejects all other calls until grounding has finished.
+class ClingoGroundFuture : public Gringo::GroundFuture {
+public:
+    ClingoGroundFuture(ClingoControl &ctl, Control::GroundVec vec, std::unique_ptr<Context> ctx);
+
+    bool get() override;
+    bool wait(double timeout) override;
+    void cancel() override;
+    uint64_t progress() override;
+    // Stops grounding and detaches the future from the control object.
+    void detach();
+    ~ClingoGroundFuture() override;
+private:
+    void run();
+    void release();
+
+    ClingoControl           *ctl_;
+    Control::GroundVec       vec_;
+    std::unique_ptr<Context> ctx_;
+    Ground::GroundProgress   progress_;
+    std::mutex               mutex_;
+    std::condition_variable  finished_;
+    std::exception_ptr       exception_;
+    bool                     done_      = false;
+    bool                     cancelled_ = false;
+    std::thread              thread_;
+};
+#endif
+
 // {{{1 declaration of ClingoLib
 
 class ClingoLib : public Clasp::EventHandler, public ClingoControl {
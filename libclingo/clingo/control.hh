@@ -57,6 +57,9 @@ struct clingo_symbolic_atoms {
     virtual Gringo::SymbolicAtomIter end() const = 0;
     virtual std::vector<Gringo::Sig> signatures() const = 0;
     virtual size_t length() const = 0;
+    // NOTE: a null signature selects all atoms; null arrays are not filled
+    virtual size_t exportSize(Gringo::Sig const *sig) const = 0;
+    virtual void exportAtoms(Gringo::Sig const *sig, Gringo::Symbol *atoms, Potassco::Lit_t *literals, unsigned *flags, size_t size) const = 0;
     virtual ~clingo_symbolic_atoms() noexcept = default;
 };
 
@@ -148,6 +151,28 @@ private:
     bool done_ = false;
 };
 
+// {{{1 declaration of GroundFuture
+
+struct GroundFuture {
+    // Blocks until grounding has finished.
+    // Returns false if grounding was cancelled and rethrows errors raised while grounding.
+    virtual bool get() = 0;
+    virtual bool wait(double timeout) = 0;
+    virtual void cancel() = 0;
+    // The number of rule instances grounded so far.
+    virtual uint64_t progress() = 0;
+    virtual ~GroundFuture() { }
+};
+using UGroundFuture = std::unique_ptr<GroundFuture>;
+
+// A future for grounding that already finished.
+struct DefaultGroundFuture : GroundFuture {
+    bool get() override { return true; }
+    bool wait(double) override { return true; }
+    void cancel() override { }
+    uint64_t progress() override { return 0; }
+};
+
 // {{{1 declaration of ConfigProxy
 
 struct ConfigProxy {
@@ -205,10 +230,12 @@ struct clingo_control {
     virtual Gringo::SymbolicAtoms &getDomain() = 0;
 
     virtual void ground(GroundVec const &vec, Gringo::Context *context) = 0;
+    virtual Gringo::UGroundFuture groundAsync(GroundVec const &vec, std::unique_ptr<Gringo::Context> context) = 0;
     virtual Gringo::USolveFuture solve(Assumptions &&assumptions, clingo_solve_mode_bitset_t mode, Gringo::USolveEventHandler cb = nullptr) = 0;
     virtual void interrupt() = 0;
     virtual void *claspFacade() = 0;
     virtual void add(std::string const &name, Gringo::StringVec const &params, std::string const &part) = 0;
+    virtual void addFacts(std::string const &name, Gringo::SymSpan facts) = 0;
     virtual void load(std::string const &filename) = 0;
     virtual Gringo::Symbol getConst(std::string const &name) = 0;
     virtual bool blocked() = 0;
@@ -217,6 +244,7 @@ struct clingo_control {
     virtual void useEnumAssumption(bool enable) = 0;
     virtual bool useEnumAssumption() = 0;
     virtual void cleanupDomains() = 0;
+    virtual void forgetSteps(unsigned begin, unsigned end) = 0;
     virtual Gringo::Output::DomainData const &theory() const = 0;
     virtual void registerPropagator(std::unique_ptr<Gringo::Propagator> p, bool sequential) = 0;
     virtual void registerObserver(Gringo::UBackend program, bool replace) = 0;
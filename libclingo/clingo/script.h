@@ -38,6 +38,11 @@ typedef struct clingo_script_ {
     bool (*main) (clingo_control_t *ctl, void *data);
     void (*free) (void *data);
     char const *version;
+    bool (*pure) (char const * name, bool *ret, void *data);
+    bool (*batchable) (char const * name, bool *ret, void *data);
+    // calls the function once with arguments_size tuples of the given arity
+    // and reports the results using one symbol callback invocation per tuple
+    bool (*call_batch) (clingo_location_t const *loc, char const *name, clingo_symbol_t const *arguments, size_t arguments_size, size_t arity, clingo_symbol_callback_t symbol_callback, void *symbol_callback_data, void *data);
 } clingo_script_t_;
 
 CLINGO_VISIBILITY_DEFAULT bool clingo_register_script_(clingo_ast_script_type_t type, clingo_script_t_ const *script, void *data);
@@ -43,7 +43,10 @@ class Scripts : public Context {
 public:
     Scripts() = default;
     bool callable(String name) override;
+    bool pure(String name) override;
+    bool batchable(String name) override;
     SymVec call(Location const &loc, String name, SymSpan args, Logger &log) override;
+    std::vector<SymVec> callBatch(Location const &loc, String name, std::vector<SymVec> const &args, Logger &log) override;
     void main(Control &ctl);
     void registerScript(clingo_ast_script_type type, UScript script);
     void setContext(Context &ctx) { context_ = &ctx; }
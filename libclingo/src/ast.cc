@@ -41,10 +41,27 @@ Location convertLoc(clingo_location loc) {
            ,loc.end_file, static_cast<unsigned>(loc.end_line), static_cast<unsigned>(loc.end_column)};
 }
 
+void *ASTBuilder::allocate_(size_t size) {
+    static constexpr size_t granularity = alignof(std::max_align_t);
+    static constexpr size_t chunkSize = 16 * 1024;
+    size = (size + granularity - 1) / granularity * granularity;
+    if (size > chunkSize) {
+        large_.emplace_back(new char[size]);
+        return large_.back().get();
+    }
+    if (chunk_ < chunks_.size() && offset_ + size > chunkSize) {
+        ++chunk_;
+        offset_ = 0;
+    }
+    if (chunk_ == chunks_.size()) { chunks_.emplace_back(new char[chunkSize]); }
+    auto *ret = chunks_[chunk_].get() + offset_;
+    offset_ += size;
+    return ret;
+}
+
 template <class T>
 T *ASTBuilder::create_() {
-    data_.emplace_back(operator new(sizeof(T)));
-    return reinterpret_cast<T*>(data_.back());
+    return reinterpret_cast<T*>(allocate_(sizeof(T)));
 }
 template <class T>
 T *ASTBuilder::create_(T x) {
@@ -54,8 +71,7 @@ T *ASTBuilder::create_(T x) {
 }
 template <class T>
 T *ASTBuilder::createArray_(size_t size) {
-    arrdata_.emplace_back(operator new[](sizeof(T) * size));
-    return reinterpret_cast<T*>(arrdata_.back());
+    return reinterpret_cast<T*>(allocate_(sizeof(T) * size));
 }
 template <class T>
 T *ASTBuilder::createArray_(std::vector<T> const &vec) {
@@ -65,10 +81,9 @@ T *ASTBuilder::createArray_(std::vector<T> const &vec) {
 }
 
 void ASTBuilder::clear_() noexcept {
-    for (auto &x : data_) { operator delete(x); }
-    for (auto &x : arrdata_) { operator delete[](x); }
-    data_.clear();
-    arrdata_.clear();
+    large_.clear();
+    chunk_ = 0;
+    offset_ = 0;
 }
 
 void ASTBuilder::statement_(Location loc, clingo_ast_statement_type_t type, clingo_ast_statement_t &stm) {
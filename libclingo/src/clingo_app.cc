@@ -82,8 +82,10 @@ void ClingoApp::initOptions(Potassco::ProgramOptions::OptionContext& root) {
          "      [no-]other:               clasp related and uncategorized warnings")
         ("rewrite-minimize,@1"      , flag(grOpts_.rewriteMinimize = false), "Rewrite minimize constraints into rules")
         ("keep-facts,@1"            , flag(grOpts_.keepFacts = false), "Do not remove facts from normal rules")
+        ("memo-limit,@1"            , storeTo(grOpts_.memoLimit = 1000000)->arg("<n>"), "Memoize at most <n> results of pure script functions")
         ("reify-sccs,@1"            , flag(grOpts_.outputOptions.reifySCCs = false), "Calculate SCCs for reified output")
         ("reify-steps,@1"           , flag(grOpts_.outputOptions.reifySteps = false), "Add step numbers to reified output")
+        ("pipeline,@1"              , flag(grOpts_.outputOptions.pipeline = false), "Pass ground rules to the solver on a separate thread")
         ("foobar,@4"                , storeTo(grOpts_.foobar, parseFoobar) , "Foobar")
         ;
     root.add(gringo);
@@ -38,70 +38,88 @@ namespace Gringo {
 
 void ClaspAPIBackend::initProgram(bool) { }
 
-void ClaspAPIBackend::endStep() { }
+void ClaspAPIBackend::endStep() {
+    // the cached text of shown terms is only kept for one step
+    terms_.clear();
+}
 
 void ClaspAPIBackend::beginStep() { }
 
 void ClaspAPIBackend::rule(Potassco::Head_t ht, const Potassco::AtomSpan& head, const Potassco::LitSpan& body) {
-    if (auto p = prg()) { p->addRule(ht, head, body); }
+    if (prg_.ok()) { prg_.addRule(ht, head, body); }
 }
 
 void ClaspAPIBackend::rule(Potassco::Head_t ht, const Potassco::AtomSpan& head, Potassco::Weight_t bound, const Potassco::WeightLitSpan& body) {
-    if (auto p = prg()) { p->addRule(ht, head, bound, body); }
+    if (prg_.ok()) { prg_.addRule(ht, head, bound, body); }
 }
 
 void ClaspAPIBackend::minimize(Potassco::Weight_t prio, const Potassco::WeightLitSpan& lits) {
-    if (auto p = prg()) { p->addMinimize(prio, lits); }
+    if (prg_.ok()) { prg_.addMinimize(prio, lits); }
 }
 
 void ClaspAPIBackend::project(const Potassco::AtomSpan& atoms) {
-    if (auto p = prg()) { p->addProject(atoms); }
+    if (prg_.ok()) { prg_.addProject(atoms); }
+}
+
+Potassco::StringSpan ClaspAPIBackend::format(Symbol sym) {
+    buffer_.clear();
+    sym.print(buffer_);
+    return {buffer_.c_str(), buffer_.size()};
+}
+
+Potassco::StringSpan ClaspAPIBackend::formatTerm(Symbol sym) {
+    auto it = terms_.find(sym);
+    if (it == terms_.end()) {
+        std::string str;
+        sym.print(str);
+        it = terms_.emplace(sym, std::move(str)).first;
+    }
+    return {it->second.c_str(), it->second.size()};
 }
 
 void ClaspAPIBackend::output(Symbol sym, Potassco::Atom_t atom) {
-    std::ostringstream out;
-    out << sym;
+    if (!prg_.ok()) { return; }
     if (atom != 0) {
         Potassco::Lit_t lit = atom;
-        if (auto p = prg()) { p->addOutput(Potassco::toSpan(out.str().c_str()), Potassco::LitSpan{&lit, 1}); }
+        prg_.addOutput(format(sym), Potassco::LitSpan{&lit, 1});
     }
     else {
-        if (auto p = prg()) { p->addOutput(Potassco::toSpan(out.str().c_str()), Potassco::LitSpan{nullptr, 0}); }
+        prg_.addOutput(format(sym), Potassco::LitSpan{nullptr, 0});
     }
 }
 
 void ClaspAPIBackend::output(Symbol sym, Potassco::LitSpan const& condition) {
-    std::ostringstream out;
-    out << sym;
-    if (auto p = prg()) { p->addOutput(Potassco::toSpan(out.str().c_str()), condition); }
+    if (prg_.ok()) { prg_.addOutput(formatTerm(sym), condition); }
 }
 
 void ClaspAPIBackend::output(Symbol sym, int value, Potassco::LitSpan const& condition) {
-    std::ostringstream out;
-    out << sym << "=" << value;
-    if (auto p = prg()) { p->addOutput(Potassco::toSpan(out.str().c_str()), condition); }
+    if (!prg_.ok()) { return; }
+    buffer_.clear();
+    sym.print(buffer_);
+    buffer_.push_back('=');
+    buffer_.append(std::to_string(value));
+    prg_.addOutput({buffer_.c_str(), buffer_.size()}, condition);
 }
 
 void ClaspAPIBackend::acycEdge(int s, int t, const Potassco::LitSpan& condition) {
-    if (auto p = prg()) { p->addAcycEdge(s, t, condition); }
+    if (prg_.ok()) { prg_.addAcycEdge(s, t, condition); }
 }
 
 void ClaspAPIBackend::heuristic(Potassco::Atom_t a, Potassco::Heuristic_t t, int bias, unsigned prio, const Potassco::LitSpan& condition) {
-    if (auto p = prg()) { p->addDomHeuristic(a, t, bias, prio, condition); }
+    if (prg_.ok()) { prg_.addDomHeuristic(a, t, bias, prio, condition); }
 }
 
 void ClaspAPIBackend::assume(const Potassco::LitSpan& lits) {
-    if (auto p = prg()) { p->addAssumption(lits); }
+    if (prg_.ok()) { prg_.addAssumption(lits); }
 }
 
 void ClaspAPIBackend::external(Potassco::Atom_t a, Potassco::Value_t v) {
-    if (auto p = prg()) {
-        switch (v) {
-            case Potassco::Value_t::False:   { p->freeze(a, Clasp::value_false); break; }
-            case Potassco::Value_t::True:    { p->freeze(a, Clasp::value_true); break; }
-            case Potassco::Value_t::Free:    { p->freeze(a, Clasp::value_free); break; }
-            case Potassco::Value_t::Release: { p->unfreeze(a); break; }
-        }
+    if (!prg_.ok()) { return; }
+    switch (v) {
+        case Potassco::Value_t::False:   { prg_.freeze(a, Clasp::value_false); break; }
+        case Potassco::Value_t::True:    { prg_.freeze(a, Clasp::value_true); break; }
+        case Potassco::Value_t::Free:    { prg_.freeze(a, Clasp::value_free); break; }
+        case Potassco::Value_t::Release: { prg_.unfreeze(a); break; }
     }
 }
 
@@ -112,27 +130,114 @@ void ClaspAPIBackend::theoryTerm(Potassco::Id_t, const Potassco::StringSpan&) {
 void ClaspAPIBackend::theoryTerm(Potassco::Id_t, int, const Potassco::IdSpan&) { }
 
 void ClaspAPIBackend::theoryElement(Potassco::Id_t e, const Potassco::IdSpan&, const Potassco::LitSpan& cond) {
-    if (auto p = prg()) {
-        Potassco::TheoryElement const &elem = p->theoryData().getElement(e);
-        if (elem.condition() == Potassco::TheoryData::COND_DEFERRED) { p->theoryData().setCondition(e, p->newCondition(cond)); }
-    }
+    if (!prg_.ok()) { return; }
+    Potassco::TheoryElement const &elem = prg_.theoryData().getElement(e);
+    if (elem.condition() == Potassco::TheoryData::COND_DEFERRED) { prg_.theoryData().setCondition(e, prg_.newCondition(cond)); }
 }
 
 void ClaspAPIBackend::theoryAtom(Potassco::Id_t, Potassco::Id_t, const Potassco::IdSpan&) { }
 
 void ClaspAPIBackend::theoryAtom(Potassco::Id_t, Potassco::Id_t, const Potassco::IdSpan&, Potassco::Id_t, Potassco::Id_t){ }
 
-Clasp::Asp::LogicProgram *ClaspAPIBackend::prg() {
-    return ctl_.update() ? static_cast<Clasp::Asp::LogicProgram*>(ctl_.clasp_->program()) : nullptr;
+ClaspAPIBackend::~ClaspAPIBackend() noexcept = default;
+
+// {{{1 definition of ClingoControlBackend
+
+bool ClingoControlBackend::update() {
+    // once the step has been started, the pipeline does not have to be synchronized again;
+    // the clasp backend then checks whether the program is still consistent
+    if (ctl_.pipeline_ && ctl_.grounded) { return true; }
+    return ctl_.update();
 }
 
-ClaspAPIBackend::~ClaspAPIBackend() noexcept = default;
+void ClingoControlBackend::initProgram(bool incremental) {
+    out_->initProgram(incremental);
+}
+
+void ClingoControlBackend::beginStep() {
+    out_->beginStep();
+}
+
+void ClingoControlBackend::rule(Potassco::Head_t ht, const Potassco::AtomSpan& head, const Potassco::LitSpan& body) {
+    if (update()) { out_->rule(ht, head, body); }
+}
+
+void ClingoControlBackend::rule(Potassco::Head_t ht, const Potassco::AtomSpan& head, Potassco::Weight_t bound, const Potassco::WeightLitSpan& body) {
+    if (update()) { out_->rule(ht, head, bound, body); }
+}
+
+void ClingoControlBackend::minimize(Potassco::Weight_t prio, const Potassco::WeightLitSpan& lits) {
+    if (update()) { out_->minimize(prio, lits); }
+}
+
+void ClingoControlBackend::project(const Potassco::AtomSpan& atoms) {
+    if (update()) { out_->project(atoms); }
+}
+
+void ClingoControlBackend::output(Symbol sym, Potassco::Atom_t atom) {
+    if (update()) { out_->output(sym, atom); }
+}
+
+void ClingoControlBackend::output(Symbol sym, Potassco::LitSpan const& condition) {
+    if (update()) { out_->output(sym, condition); }
+}
+
+void ClingoControlBackend::output(Symbol sym, int value, Potassco::LitSpan const& condition) {
+    if (update()) { out_->output(sym, value, condition); }
+}
+
+void ClingoControlBackend::acycEdge(int s, int t, const Potassco::LitSpan& condition) {
+    if (update()) { out_->acycEdge(s, t, condition); }
+}
+
+void ClingoControlBackend::heuristic(Potassco::Atom_t a, Potassco::Heuristic_t t, int bias, unsigned prio, const Potassco::LitSpan& condition) {
+    if (update()) { out_->heuristic(a, t, bias, prio, condition); }
+}
+
+void ClingoControlBackend::assume(const Potassco::LitSpan& lits) {
+    if (update()) { out_->assume(lits); }
+}
+
+void ClingoControlBackend::external(Potassco::Atom_t a, Potassco::Value_t v) {
+    if (update()) { out_->external(a, v); }
+}
+
+void ClingoControlBackend::theoryTerm(Potassco::Id_t termId, int number) {
+    out_->theoryTerm(termId, number);
+}
+
+void ClingoControlBackend::theoryTerm(Potassco::Id_t termId, const Potassco::StringSpan& name) {
+    out_->theoryTerm(termId, name);
+}
+
+void ClingoControlBackend::theoryTerm(Potassco::Id_t termId, int cId, const Potassco::IdSpan& args) {
+    out_->theoryTerm(termId, cId, args);
+}
+
+void ClingoControlBackend::theoryElement(Potassco::Id_t elementId, const Potassco::IdSpan& terms, const Potassco::LitSpan& cond) {
+    if (update()) { out_->theoryElement(elementId, terms, cond); }
+}
+
+void ClingoControlBackend::theoryAtom(Potassco::Id_t atomOrZero, Potassco::Id_t termId, const Potassco::IdSpan& elements) {
+    out_->theoryAtom(atomOrZero, termId, elements);
+}
+
+void ClingoControlBackend::theoryAtom(Potassco::Id_t atomOrZero, Potassco::Id_t termId, const Potassco::IdSpan& elements, Potassco::Id_t op, Potassco::Id_t rhs) {
+    out_->theoryAtom(atomOrZero, termId, elements, op, rhs);
+}
+
+void ClingoControlBackend::endStep() {
+    out_->endStep();
+}
+
+ClingoControlBackend::~ClingoControlBackend() noexcept = default;
 
 // {{{1 definition of ClingoControl
 
 #define LOG if (verbose_) std::cerr
 ClingoControl::ClingoControl(Scripts &scripts, bool clingoMode, Clasp::ClaspFacade *clasp, Clasp::Cli::ClaspCliConfig &claspConfig, PostGroundFunc pgf, PreSolveFunc psf, Logger::Printer printer, unsigned messageLimit)
 : scripts_(scripts)
+, memo_(scripts)
 , clasp_(clasp)
 , claspConfig_(claspConfig)
 , pgf_(pgf)
@@ -174,14 +279,33 @@ void ClingoControl::parse(const StringVec& files, const ClingoOptions& opts, Cla
         outPreds.emplace_back(Location("<cmd>",1,1,"<cmd>", 1,1), x, false);
     }
     if (claspOut) {
-        out_ = gringo_make_unique<Output::OutputBase>(claspOut->theoryData(), std::move(outPreds), gringo_make_unique<ClaspAPIBackend>(*this), opts.outputOptions);
+        // the clasp program is resolved here so that pipelined statements
+        // can be passed to it without touching the control object
+        auto claspBackend = gringo_make_unique<ClaspAPIBackend>(*claspOut);
+        claspBackend_ = claspBackend.get();
+        UBackend backend = std::move(claspBackend);
+        auto outputOptions = opts.outputOptions;
+#if CLASP_HAS_THREADS
+        if (outputOptions.pipeline) {
+            auto pipeline = gringo_make_unique<Output::PipelinedBackend>(std::move(backend));
+            pipeline_ = pipeline.get();
+            backend = std::move(pipeline);
+        }
+#else
+        if (outputOptions.pipeline) { throw std::runtime_error("option --pipeline requires thread support"); }
+#endif
+        outputOptions.pipeline = false;
+        backend = gringo_make_unique<ClingoControlBackend>(*this, std::move(backend));
+        out_ = gringo_make_unique<Output::OutputBase>(claspOut->theoryData(), std::move(outPreds), std::move(backend), outputOptions);
     }
     else {
         data_ = gringo_make_unique<Potassco::TheoryData>();
         out_ = gringo_make_unique<Output::OutputBase>(*data_, std::move(outPreds), std::cout, opts.outputFormat, opts.outputOptions);
     }
     out_->keepFacts = opts.keepFacts;
-    pb_ = gringo_make_unique<Input::NongroundProgramBuilder>(scripts_, prg_, *out_, defs_, opts.rewriteMinimize);
+    memo_.setLimit(opts.memoLimit);
+    prg_.setThreads(opts.rewriteThreads);
+    pb_ = gringo_make_unique<Input::NongroundProgramBuilder>(memo_, prg_, *out_, defs_, opts.rewriteMinimize);
     parser_ = gringo_make_unique<Input::NonGroundParser>(*pb_, incmode_);
     for (auto &x : opts.defines) {
         LOG << "define: " << x << std::endl;
@@ -199,6 +323,8 @@ void ClingoControl::parse(const StringVec& files, const ClingoOptions& opts, Cla
 }
 
 bool ClingoControl::update() {
+    // clasp must not be updated while the pipeline adds statements
+    sync();
     if (clingoMode_) {
         clasp_->update(configUpdate_);
         configUpdate_ = false;
@@ -216,6 +342,21 @@ bool ClingoControl::update() {
 }
 
 void ClingoControl::ground(Control::GroundVec const &parts, Context *context) {
+    checkGrounding();
+    ground(parts, context, nullptr);
+}
+
+UGroundFuture ClingoControl::groundAsync(Control::GroundVec const &parts, std::unique_ptr<Context> context) {
+    checkGrounding();
+#if CLASP_HAS_THREADS
+    return gringo_make_unique<ClingoGroundFuture>(*this, parts, std::move(context));
+#else
+    ground(parts, context.get(), nullptr);
+    return gringo_make_unique<DefaultGroundFuture>();
+#endif
+}
+
+void ClingoControl::ground(Control::GroundVec const &parts, Context *context, Ground::GroundProgress *progress) {
     if (!update()) { return; }
     if (parsed) {
         LOG << "************** parsed program **************" << std::endl << prg_;
@@ -230,12 +371,19 @@ void ClingoControl::ground(Control::GroundVec const &parts, Context *context) {
     if (!parts.empty()) {
         Ground::Parameters params;
         for (auto &x : parts) { params.add(x.first, SymVec(x.second)); }
-        auto gPrg = prg_.toGround(out_->data, logger_);
+        auto gPrg = prg_.toGround(params, out_->data, logger_);
         LOG << "*********** intermediate program ***********" << std::endl << gPrg << std::endl;
         LOG << "************* grounded program *************" << std::endl;
-        auto exit = onExit([this]{ scripts_.resetContext(); });
-        if (context) { scripts_.setContext(*context); }
-        gPrg.ground(params, scripts_, *out_, false, logger_);
+        auto exit = onExit([this, context]{
+            scripts_.resetContext();
+            if (context) { memo_.reset(); }
+        });
+        if (context) {
+            scripts_.setContext(*context);
+            memo_.reset();
+        }
+        gPrg.ground(params, memo_, *out_, false, logger_, progress);
+        LOG << "memoized calls: " << memo_.hits() << " hits, " << memo_.misses() << " misses, " << memo_.size() << " results" << std::endl;
     }
 }
 
@@ -274,6 +422,7 @@ void ClingoControl::onFinish(Clasp::ClaspFacade::Result ret) {
     }
 }
 Symbol ClingoControl::getConst(std::string const &name) {
+    checkGrounding();
     auto ret = defs_.defs().find(name.c_str());
     if (ret != defs_.defs().end()) {
         bool undefined = false;
@@ -283,13 +432,20 @@ Symbol ClingoControl::getConst(std::string const &name) {
     return Symbol();
 }
 void ClingoControl::add(std::string const &name, Gringo::StringVec const &params, std::string const &part) {
+    checkGrounding();
     Location loc("<block>", 1, 1, "<block>", 1, 1);
     Input::IdVec idVec;
     for (auto &x : params) { idVec.emplace_back(loc, x); }
     parser_->pushBlock(name, std::move(idVec), part, logger_);
     parse();
 }
+void ClingoControl::addFacts(std::string const &name, Gringo::SymSpan facts) {
+    checkGrounding();
+    parse();
+    prg_.addFacts(name.c_str(), facts);
+}
 void ClingoControl::load(std::string const &filename) {
+    checkGrounding();
     parser_->pushFile(std::string(filename), logger_);
     parse();
 }
@@ -340,9 +496,11 @@ unsigned ClingoControl::getRootKey() {
     return Clasp::Cli::ClaspCliConfig::KEY_ROOT;
 }
 ConfigProxy &ClingoControl::getConf() {
+    checkGrounding();
     return *this;
 }
 USolveFuture ClingoControl::solve(Assumptions &&ass, clingo_solve_mode_bitset_t mode, USolveEventHandler cb) {
+    checkGrounding();
     prepare(std::move(ass));
     if (clingoMode_) {
         static_assert(clingo_solve_mode_yield == static_cast<clingo_solve_mode_bitset_t>(Clasp::SolveMode_t::Yield), "");
@@ -388,10 +546,13 @@ void ClingoControl::prepare(Assumptions &&ass) {
 }
 
 void *ClingoControl::claspFacade() {
+    checkGrounding();
     return clasp_;
 }
 
 void ClingoControl::registerPropagator(std::unique_ptr<Propagator> p, bool sequential) {
+    checkGrounding();
+    sync();
     propagators_.emplace_back(gringo_make_unique<Clasp::ClingoPropagatorInit>(*p, propLock_.add(sequential)));
     claspConfig_.addConfigurator(propagators_.back().get(), Clasp::Ownership_t::Retain);
     static_cast<Clasp::Asp::LogicProgram*>(clasp_->program())->enableDistinctTrue();
@@ -399,6 +560,16 @@ void ClingoControl::registerPropagator(std::unique_ptr<Propagator> p, bool seque
 }
 
 void ClingoControl::cleanupDomains() {
+    checkGrounding();
+    cleanup(0, 0);
+}
+
+void ClingoControl::forgetSteps(unsigned begin, unsigned end) {
+    checkGrounding();
+    cleanup(begin, end);
+}
+
+void ClingoControl::cleanup(Id_t forgetBegin, Id_t forgetEnd) {
     out_->endStep(false, logger_);
     if (clingoMode_) {
         Clasp::Asp::LogicProgram &prg = static_cast<Clasp::Asp::LogicProgram&>(*clasp_->program());
@@ -411,10 +582,13 @@ void ClingoControl::cleanupDomains() {
             else if (solver.isFalse(lit)) { truth = Potassco::Value_t::False; }
             return std::make_pair(prg.isExternal(uid), truth);
         };
-        auto stats = out_->simplify(assignment);
+        auto stats = out_->simplify(assignment, forgetBegin, forgetEnd);
         LOG << stats.first << " atom" << (stats.first == 1 ? "" : "s") << " became facts" << std::endl;
         LOG << stats.second << " atom" << (stats.second == 1 ? "" : "s") << " deleted" << std::endl;
     }
+    else if (forgetBegin < forgetEnd) {
+        out_->simplify([](unsigned) { return std::make_pair(false, Potassco::Value_t::Free); }, forgetBegin, forgetEnd);
+    }
 }
 
 std::string ClingoControl::str() {
@@ -422,6 +596,7 @@ std::string ClingoControl::str() {
 }
 
 void ClingoControl::assignExternal(Symbol ext, Potassco::Value_t val) {
+    checkGrounding();
     if (update()) {
         auto atm = out_->find(ext);
         if (atm.second && atm.first->hasUid()) {
@@ -433,6 +608,7 @@ void ClingoControl::assignExternal(Symbol ext, Potassco::Value_t val) {
 }
 
 Potassco::AbstractStatistics *ClingoControl::statistics() {
+    checkGrounding();
     return clasp_->getStats();
 }
 
@@ -444,6 +620,7 @@ bool ClingoControl::useEnumAssumption() {
 }
 
 SymbolicAtoms &ClingoControl::getDomain() {
+    checkGrounding();
     if (clingoMode_) { return *this; }
     else {
         throw std::runtime_error("domain introspection only supported in clingo mode");
@@ -530,6 +707,7 @@ bool ClingoControl::fact(SymbolicAtomIter it) const {
 }
 
 bool ClingoControl::external(SymbolicAtomIter it) const {
+    sync();
     auto &elem = domainElem(out_->predDoms(), it);
     return elem.hasUid() && elem.isExternal() && static_cast<Clasp::Asp::LogicProgram*>(clasp_->program())->isExternal(elem.uid());
 }
@@ -591,10 +769,75 @@ size_t ClingoControl::length() const {
     return ret;
 }
 
-Backend *ClingoControl::backend() { return out_->backend(); }
-Potassco::Atom_t ClingoControl::addProgramAtom() { return out_->data.newAtom(); }
+size_t ClingoControl::exportSize(Sig const *sig) const {
+    if (sig == nullptr) { return length(); }
+    auto it = out_->predDoms().find(*sig);
+    return it != out_->predDoms().end() && !skipDomain(**it) ? (*it)->size() : 0;
+}
+
+void ClingoControl::exportAtoms(Sig const *sig, Symbol *atoms, Potassco::Lit_t *literals, unsigned *flags, size_t size) const {
+    if (size < exportSize(sig)) { throw std::length_error("not enough space"); }
+    sync();
+    auto *prg = static_cast<Clasp::Asp::LogicProgram*>(clasp_->program());
+    auto fill = [&](Output::PredicateDomain &dom) {
+        for (auto &elem : dom) {
+            if (atoms) { *atoms++ = elem; }
+            if (literals) { *literals++ = elem.hasUid() ? elem.uid() : 0; }
+            if (flags) {
+                *flags++ =
+                    (elem.fact() ? clingo_symbolic_atom_flag_fact : 0u) |
+                    (elem.hasUid() && elem.isExternal() && prg->isExternal(elem.uid()) ? clingo_symbolic_atom_flag_external : 0u);
+            }
+        }
+    };
+    if (sig != nullptr) {
+        auto it = out_->predDoms().find(*sig);
+        if (it != out_->predDoms().end() && !skipDomain(**it)) { fill(**it); }
+    }
+    else {
+        for (auto &dom : out_->predDoms()) {
+            if (!skipDomain(*dom)) { fill(*dom); }
+        }
+    }
+}
+
+Backend *ClingoControl::backend() {
+    checkGrounding();
+    sync();
+    return out_->backend();
+}
+Potassco::Atom_t ClingoControl::addProgramAtom() {
+    checkGrounding();
+    return out_->data.newAtom();
+}
+
+ClingoControl::~ClingoControl() noexcept {
+    shutdown();
+}
+
+void ClingoControl::shutdown() noexcept {
+#if CLASP_HAS_THREADS
+    try {
+        if (groundFuture_) { groundFuture_->detach(); }
+        sync();
+    }
+    catch (...) { }
+#endif
+}
 
-ClingoControl::~ClingoControl() noexcept = default;
+void ClingoControl::sync() const {
+#if CLASP_HAS_THREADS
+    if (pipeline_) { pipeline_->sync(); }
+#endif
+}
+
+void ClingoControl::checkGrounding() {
+#if CLASP_HAS_THREADS
+    if (groundFuture_ && !groundFuture_->wait(0)) {
+        throw std::runtime_error("control object must not be used while grounding");
+    }
+#endif
+}
 
 // {{{1 definition of ClingoSolveFuture
 
@@ -637,6 +880,67 @@ void ClingoSolveFuture::resume() {
     handle_.resume();
 }
 
+// {{{1 definition of ClingoGroundFuture
+
+#if CLASP_HAS_THREADS
+ClingoGroundFuture::ClingoGroundFuture(ClingoControl &ctl, Control::GroundVec vec, std::unique_ptr<Context> ctx)
+: ctl_(&ctl)
+, vec_(std::move(vec))
+, ctx_(std::move(ctx)) {
+    ctl_->groundFuture_ = this;
+    thread_ = std::thread([this]() { run(); });
+}
+
+void ClingoGroundFuture::run() {
+    bool cancelled = false;
+    std::exception_ptr exception;
+    try                                     { ctl_->ground(vec_, ctx_.get(), &progress_); }
+    catch (Ground::GroundCancelled const &) { cancelled = true; }
+    catch (...)                             { exception = std::current_exception(); }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancelled_ = cancelled;
+        exception_ = exception;
+        done_ = true;
+    }
+    finished_.notify_all();
+}
+void ClingoGroundFuture::release() {
+    if (thread_.joinable()) { thread_.join(); }
+    if (ctl_ && ctl_->groundFuture_ == this) { ctl_->groundFuture_ = nullptr; }
+}
+bool ClingoGroundFuture::get() {
+    wait(-1);
+    if (exception_) { std::rethrow_exception(exception_); }
+    return !cancelled_;
+}
+bool ClingoGroundFuture::wait(double timeout) {
+    bool done;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (timeout == 0)     { done = done_; }
+        else if (timeout < 0) { done = (finished_.wait(lock, [this]() { return done_; }), true); }
+        else                  { done = finished_.wait_for(lock, std::chrono::duration<double>(timeout), [this]() { return done_; }); }
+    }
+    if (done) { release(); }
+    return done;
+}
+void ClingoGroundFuture::cancel() {
+    progress_.cancel();
+    wait(-1);
+}
+uint64_t ClingoGroundFuture::progress() {
+    return progress_.instances();
+}
+void ClingoGroundFuture::detach() {
+    cancel();
+    ctl_ = nullptr;
+}
+ClingoGroundFuture::~ClingoGroundFuture() {
+    cancel();
+}
+#endif
+
 // {{{1 definition of ClingoLib
 
 ClingoLib::ClingoLib(Scripts &scripts, int argc, char const * const *argv, Logger::Printer printer, unsigned messageLimit)
@@ -688,6 +992,9 @@ void ClingoLib::initOptions(Potassco::ProgramOptions::OptionContext& root) {
          "      [no-]other:               clasp related and uncategorized warnings")
         ("rewrite-minimize"         , flag(grOpts_.rewriteMinimize = false), "Rewrite minimize constraints into rules")
         ("keep-facts"               , flag(grOpts_.keepFacts = false), "Do not remove facts from normal rules")
+        ("pipeline"                 , flag(grOpts_.outputOptions.pipeline = false), "Pass ground rules to the solver on a separate thread")
+        ("memo-limit"               , storeTo(grOpts_.memoLimit = 1000000)->arg("<n>"), "Memoize at most <n> results of pure script functions")
+        ("rewrite-threads"          , storeTo(grOpts_.rewriteThreads = 1)->arg("<n>"), "Rewrite and check statements using at most <n> threads (0: one per core)")
         ;
     root.add(gringo);
     claspConfig_.addOptions(root);
@@ -711,6 +1018,8 @@ bool ClingoLib::parsePositional(const std::string& t, std::string& out) {
     return false;
 }
 ClingoLib::~ClingoLib() {
+    // clasp has to outlive grounding and pipelined statements
+    shutdown();
     clasp_.shutdown();
 }
 
@@ -392,6 +392,22 @@ extern "C" bool clingo_symbolic_atoms_signatures(clingo_symbolic_atoms_t *dom, c
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_symbolic_atoms_export_size(clingo_symbolic_atoms_t *dom, clingo_signature_t const *sig, size_t *n) {
+    GRINGO_CLINGO_TRY {
+        Sig s = sig ? Sig(*sig) : Sig("", 0, false);
+        *n = dom->exportSize(sig ? &s : nullptr);
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
+extern "C" bool clingo_symbolic_atoms_export(clingo_symbolic_atoms_t *dom, clingo_signature_t const *sig, clingo_symbol_t *symbols, clingo_literal_t *literals, clingo_symbolic_atom_flags_t *flags, size_t n) {
+    GRINGO_CLINGO_TRY {
+        Sig s = sig ? Sig(*sig) : Sig("", 0, false);
+        dom->exportAtoms(sig ? &s : nullptr, reinterpret_cast<Symbol *>(symbols), literals, flags, n);
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_symbolic_atoms_size(clingo_symbolic_atoms_t *dom, size_t *size) {
     GRINGO_CLINGO_TRY { *size = dom->length(); }
     GRINGO_CLINGO_CATCH;
@@ -1035,6 +1051,30 @@ extern "C" bool clingo_solve_handle_resume(clingo_solve_handle_t *handle) {
     GRINGO_CLINGO_CATCH;
 }
 
+// {{{1 ground handle
+
+struct clingo_ground_handle : public Gringo::GroundFuture { };
+
+extern "C" bool clingo_ground_handle_get(clingo_ground_handle_t *handle, bool *completed) {
+    GRINGO_CLINGO_TRY { *completed = handle->get(); }
+    GRINGO_CLINGO_CATCH;
+}
+extern "C" void clingo_ground_handle_wait(clingo_ground_handle_t *handle, double timeout, bool *result) {
+    try { *result = handle->wait(timeout); }
+    catch (...) { std::terminate(); }
+}
+extern "C" void clingo_ground_handle_progress(clingo_ground_handle_t *handle, uint64_t *progress) {
+    *progress = handle->progress();
+}
+extern "C" bool clingo_ground_handle_cancel(clingo_ground_handle_t *handle) {
+    GRINGO_CLINGO_TRY { handle->cancel(); }
+    GRINGO_CLINGO_CATCH;
+}
+extern "C" bool clingo_ground_handle_close(clingo_ground_handle_t *handle) {
+    GRINGO_CLINGO_TRY { if (handle) { delete handle; } }
+    GRINGO_CLINGO_CATCH;
+}
+
 // {{{1 control
 
 struct clingo_program_builder : clingo_control_t { };
@@ -1068,6 +1108,11 @@ extern "C" bool clingo_control_add(clingo_control_t *ctl, char const *name, char
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_control_add_facts(clingo_control_t *ctl, char const *name, clingo_symbol_t const *facts, size_t size) {
+    GRINGO_CLINGO_TRY { ctl->addFacts(name, {reinterpret_cast<Symbol const *>(facts), size}); }
+    GRINGO_CLINGO_CATCH;
+}
+
 namespace {
 
 struct ClingoContext : Context {
@@ -1105,25 +1150,39 @@ struct ClingoContext : Context {
     SymVec ret;
 };
 
+Control::GroundVec toGroundVec(clingo_part_t const * vec, size_t n) {
+    Control::GroundVec gv;
+    gv.reserve(n);
+    for (auto it = vec, ie = it + n; it != ie; ++it) {
+        SymVec params;
+        params.reserve(it->size);
+        for (auto jt = it->params, je = jt + it->size; jt != je; ++jt) {
+            params.emplace_back(Symbol(*jt));
+        }
+        gv.emplace_back(it->name, params);
+    }
+    return gv;
+}
+
 }
 
 extern "C" bool clingo_control_ground(clingo_control_t *ctl, clingo_part_t const * vec, size_t n, clingo_ground_callback_t cb, void *data) {
     GRINGO_CLINGO_TRY {
-        Control::GroundVec gv;
-        gv.reserve(n);
-        for (auto it = vec, ie = it + n; it != ie; ++it) {
-            SymVec params;
-            params.reserve(it->size);
-            for (auto jt = it->params, je = jt + it->size; jt != je; ++jt) {
-                params.emplace_back(Symbol(*jt));
-            }
-            gv.emplace_back(it->name, params);
-        }
+        auto gv = toGroundVec(vec, n);
         ClingoContext cctx(ctl, cb, data);
         ctl->ground(gv, cb ? &cctx : nullptr);
     } GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_control_ground_async(clingo_control_t *ctl, clingo_part_t const * vec, size_t n, clingo_ground_callback_t cb, void *data, clingo_ground_handle_t **handle) {
+    GRINGO_CLINGO_TRY {
+        auto gv = toGroundVec(vec, n);
+        std::unique_ptr<Context> cctx;
+        if (cb) { cctx = gringo_make_unique<ClingoContext>(ctl, cb, data); }
+        *handle = static_cast<clingo_ground_handle_t*>(ctl->groundAsync(gv, std::move(cctx)).release());
+    } GRINGO_CLINGO_CATCH;
+}
+
 namespace {
 
 Control::Assumptions toAss(clingo_symbolic_literal_t const * assumptions, size_t n) {
@@ -1231,6 +1290,11 @@ extern "C" bool clingo_control_cleanup(clingo_control_t *ctl) {
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_control_forget_steps(clingo_control_t *ctl, unsigned begin, unsigned end) {
+    GRINGO_CLINGO_TRY { ctl->forgetSteps(begin, end); }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_control_has_const(clingo_control_t *ctl, char const *name, bool *ret) {
     GRINGO_CLINGO_TRY {
         auto sym = ctl->getConst(name);
@@ -1371,6 +1435,15 @@ extern "C" bool clingo_control_register_observer(clingo_control_t *control, clin
     GRINGO_CLINGO_CATCH;
 }
 
+extern "C" bool clingo_control_register_reifier(clingo_control_t *control, clingo_control_t *target, char const *name, bool calculate_sccs, bool reify_steps, bool replace) {
+    GRINGO_CLINGO_TRY {
+        std::string part = name;
+        auto cb = [target, part](SymSpan facts) { target->addFacts(part, facts); };
+        control->registerObserver(gringo_make_unique<Output::ReifyBackend>(cb, calculate_sccs, reify_steps), replace);
+    }
+    GRINGO_CLINGO_CATCH;
+}
+
 extern "C" bool clingo_control_new(char const *const * args, size_t n, clingo_logger_t logger, void *data, unsigned message_limit, clingo_control_t **ctl) {
     GRINGO_CLINGO_TRY {
         static std::mutex mut;
@@ -1424,6 +1497,47 @@ private:
         handleCError(script_.callable(name.c_str(), &ret, data_));
         return ret;
     }
+    bool pure(String name) override {
+        bool ret = false;
+        if (script_.pure) { handleCError(script_.pure(name.c_str(), &ret, data_)); }
+        return ret;
+    }
+    bool batchable(String name) override {
+        bool ret = false;
+        if (script_.batchable && script_.call_batch) { handleCError(script_.batchable(name.c_str(), &ret, data_)); }
+        return ret;
+    }
+    std::vector<SymVec> callBatch(Location const &loc, String name, std::vector<SymVec> const &args, Logger &log) override {
+        if (!script_.call_batch) { return Script::callBatch(loc, name, args, log); }
+        using Data = std::pair<std::vector<SymVec>, std::exception_ptr>;
+        Data data;
+        size_t arity = args.empty() ? 0 : args.front().size();
+        SymVec flat;
+        flat.reserve(args.size() * arity);
+        for (auto &x : args) { flat.insert(flat.end(), x.begin(), x.end()); }
+        auto l = conv(loc);
+        handleCError(script_.call_batch(
+            &l, name.c_str(), reinterpret_cast<clingo_symbol_t const *>(flat.data()), args.size(), arity,
+            [](clingo_symbol_t const *symbols, size_t symbols_size, void *data) {
+                try {
+                    auto &ret = static_cast<Data*>(data)->first;
+                    ret.emplace_back();
+                    for (auto it = symbols, ie = it + symbols_size; it != ie; ++it) {
+                        ret.back().emplace_back(Symbol{*it});
+                    }
+                    return true;
+                }
+                catch (...) {
+                    handleCXXError();
+                    return false;
+                }
+            },
+            &data, data_), &data.second);
+        if (data.first.size() != args.size()) {
+            throw std::runtime_error("batched call returned wrong number of results");
+        }
+        return std::move(data.first);
+    }
     void main(Control &ctl) override {
         handleCError(script_.main(&ctl, data_));
     }
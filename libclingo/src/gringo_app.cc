@@ -59,6 +59,8 @@ struct GringoOptions {
     bool                          wNoOther              = false;
     bool                          rewriteMinimize       = false;
     bool                          keepFacts             = false;
+    unsigned                      memoLimit             = 1000000;
+    unsigned                      rewriteThreads        = 1;
     Foobar                        foobar;
 };
 
@@ -92,12 +94,14 @@ struct IncrementalControl : Control {
     IncrementalControl(Output::OutputBase &out, StrVec const &files, GringoOptions const &opts)
     : out(out)
     , scripts(g_scripts())
-    , pb(scripts, prg, out, defs, opts.rewriteMinimize)
+    , memo(scripts, opts.memoLimit)
+    , pb(memo, prg, out, defs, opts.rewriteMinimize)
     , parser(pb, incmode)
     , opts(opts) {
         using namespace Gringo;
         // TODO: should go where python script is once refactored
         out.keepFacts = opts.keepFacts;
+        prg.setThreads(opts.rewriteThreads);
         logger_.enable(Warnings::OperationUndefined, !opts.wNoOperationUndefined);
         logger_.enable(Warnings::AtomUndefined, !opts.wNoAtomUndef);
         logger_.enable(Warnings::VariableUnbounded, !opts.wNoVariableUnbounded);
@@ -130,8 +134,14 @@ struct IncrementalControl : Control {
     }
     void ground(Control::GroundVec const &parts, Context *context) override {
         // NOTE: it would be cool to have assumptions in the lparse output
-        auto exit = onExit([this]{ scripts.resetContext(); });
-        if (context) { scripts.setContext(*context); }
+        auto exit = onExit([this, context]{
+            scripts.resetContext();
+            if (context) { memo.reset(); }
+        });
+        if (context) {
+            scripts.setContext(*context);
+            memo.reset();
+        }
         parse();
         if (parsed) {
             LOG << "************** parsed program **************" << std::endl << prg;
@@ -154,12 +164,17 @@ struct IncrementalControl : Control {
         if (!parts.empty()) {
             Ground::Parameters params;
             for (auto &x : parts) { params.add(x.first, SymVec(x.second)); }
-            Ground::Program gPrg(prg.toGround(out.data, logger_));
+            Ground::Program gPrg(prg.toGround(params, out.data, logger_));
             LOG << "************* intermediate program *************" << std::endl << gPrg << std::endl;
             LOG << "*************** grounded program ***************" << std::endl;
-            gPrg.ground(params, scripts, out, false, logger_);
+            gPrg.ground(params, memo, out, false, logger_);
+            LOG << "memoized calls: " << memo.hits() << " hits, " << memo.misses() << " misses, " << memo.size() << " results" << std::endl;
         }
     }
+    UGroundFuture groundAsync(Control::GroundVec const &parts, std::unique_ptr<Context> context) override {
+        ground(parts, context.get());
+        return gringo_make_unique<DefaultGroundFuture>();
+    }
     void add(std::string const &name, StringVec const &params, std::string const &part) override {
         Location loc("<block>", 1, 1, "<block>", 1, 1);
         Input::IdVec idVec;
@@ -167,6 +182,10 @@ struct IncrementalControl : Control {
         parser.pushBlock(name, std::move(idVec), part, logger_);
         parse();
     }
+    void addFacts(std::string const &name, SymSpan facts) override {
+        parse();
+        prg.addFacts(name.c_str(), facts);
+    }
     Symbol getConst(std::string const &name) override {
         parse();
         auto ret = defs.defs().find(name.c_str());
@@ -222,11 +241,13 @@ struct IncrementalControl : Control {
     virtual ~IncrementalControl() { }
     Output::DomainData const &theory() const override { return out.data; }
     void cleanupDomains() override { }
+    void forgetSteps(unsigned, unsigned) override { }
     Backend *backend() override { return out.backend(); }
     Potassco::Atom_t addProgramAtom() override { return out.data.newAtom(); }
     Input::GroundTermParser        termParser;
     Output::OutputBase            &out;
     Scripts                       &scripts;
+    MemoContext                    memo;
     Defines                        defs;
     Input::Program                 prg;
     Input::NongroundProgramBuilder pb;
@@ -322,8 +343,11 @@ struct GringoApp : public Potassco::Application {
              "      [no-]other:               uncategorized warnings")
             ("rewrite-minimize,@1", flag(grOpts_.rewriteMinimize = false), "Rewrite minimize constraints into rules")
             ("keep-facts,@1", flag(grOpts_.keepFacts = false), "Do not remove facts from normal rules")
+            ("memo-limit,@1", storeTo(grOpts_.memoLimit = 1000000)->arg("<n>"), "Memoize at most <n> results of pure script functions")
+            ("rewrite-threads,@1", storeTo(grOpts_.rewriteThreads = 1)->arg("<n>"), "Rewrite and check statements using at most <n> threads (0: one per core)")
             ("reify-sccs,@1", flag(grOpts_.outputOptions.reifySCCs = false), "Calculate SCCs for reified output")
             ("reify-steps,@1", flag(grOpts_.outputOptions.reifySteps = false), "Add step numbers to reified output")
+            ("pipeline,@1", flag(grOpts_.outputOptions.pipeline = false), "Write ground rules on a separate thread")
             ("foobar,@4", storeTo(grOpts_.foobar, parseFoobar), "Foobar")
             ;
         root.add(gringo);
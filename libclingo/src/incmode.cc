@@ -45,6 +45,14 @@ struct Incmode {
         return 0;
     }
 
+    int get_forget() {
+        auto iforget  = ctl_.getConst("iforget");
+        if (iforget.type() == Gringo::SymbolType::Num) {
+            return iforget.num();
+        }
+        return 0;
+    }
+
     String get_stop() {
         auto istop  = ctl_.getConst("istop");
         if (istop.type() == Gringo::SymbolType::Str) { return istop.string(); }
@@ -67,6 +75,7 @@ struct Incmode {
         imax = get_max();
         imin = get_min();
         istop = get_stop();
+        iforget = get_forget();
 
         while (check_run()) {
             Control::GroundVec parts;
@@ -74,7 +83,9 @@ struct Incmode {
             parts.push_back({"check", {Symbol::createNum(step)}});
             if (step > 0) {
                 ctl_.assignExternal(Symbol::createFun("query", {Symbol::createNum(step - 1)}), Potassco::Value_t::Release);
-                ctl_.cleanupDomains();
+                // keep the base program and the last iforget steps
+                if (iforget > 0 && step - iforget > 1) { ctl_.forgetSteps(1, step - iforget); }
+                else                                   { ctl_.cleanupDomains(); }
                 parts.push_back({"step", {Symbol::createNum(step)}});
             }
             else {
@@ -90,6 +101,7 @@ struct Incmode {
     Control &ctl_;
     int imax = 0;
     int imin = 0;
+    int iforget = 0;
     int step = 0;
     String istop;
     SolveResult res;
@@ -37,6 +37,26 @@ bool Scripts::callable(String name) {
     return false;
 }
 
+bool Scripts::pure(String name) {
+    if (context_ && context_->callable(name)) { return context_->pure(name); }
+    for (auto &&script : scripts_) {
+        if (script.second->callable(name)) {
+            return script.second->pure(name);
+        }
+    }
+    return false;
+}
+
+bool Scripts::batchable(String name) {
+    if (context_ && context_->callable(name)) { return context_->batchable(name); }
+    for (auto &&script : scripts_) {
+        if (script.second->callable(name)) {
+            return script.second->batchable(name);
+        }
+    }
+    return false;
+}
+
 void Scripts::main(Control &ctl) {
     for (auto &&script : scripts_) {
         if (script.second->callable("main")) {
@@ -60,6 +80,16 @@ SymVec Scripts::call(Location const &loc, String name, SymSpan args, Logger &log
     return {};
 }
 
+std::vector<SymVec> Scripts::callBatch(Location const &loc, String name, std::vector<SymVec> const &args, Logger &log) {
+    if (context_ && context_->callable(name)) { return context_->callBatch(loc, name, args, log); }
+    for (auto &&script : scripts_) {
+        if (script.second->callable(name)) {
+            return script.second->callBatch(loc, name, args, log);
+        }
+    }
+    return Context::callBatch(loc, name, args, log);
+}
+
 void Scripts::registerScript(clingo_ast_script_type type, UScript script) {
     if (script) { scripts_.emplace_back(type, std::move(script)); }
 }
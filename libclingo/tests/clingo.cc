@@ -25,6 +25,8 @@
 #include "tests.hh"
 #include <iostream>
 #include <fstream>
+#include <future>
+#include <thread>
 #ifdef _MSC_VER
 #pragma warning (disable : 4996) // 'tmpnam': may be unsafe.
 #endif
@@ -261,6 +263,35 @@ TEST_CASE("solving", "[clingo]") {
             REQUIRE(sat);
             REQUIRE(messages.empty());
         }
+        SECTION("add_facts") {
+            ctl.add("base", {}, "#const n=1. q(X) :- p(X), X > n.");
+            ctl.add_facts("base", {Function("p", {Number(1)}), Function("p", {Number(2)}), Id("n")});
+            REQUIRE_THROWS(ctl.add_facts("base", {Number(1)}));
+            // no fact is added if one of them is invalid
+            REQUIRE_THROWS(ctl.add_facts("base", {Function("p", {Number(3)}), String("s")}));
+            ctl.ground({{"base", {}}});
+            for (auto m : ctl.solve()) {
+                models.emplace_back(m.symbols(ShowType::Atoms));
+                std::sort(models.back().begin(), models.back().end());
+            }
+            REQUIRE(models == ModelVec({{Id("n"), Function("p", {Number(1)}), Function("p", {Number(2)}), Function("q", {Number(2)})}}));
+            REQUIRE(messages.empty());
+        }
+        SECTION("register_reifier") {
+            Control meta;
+            meta.add("base", {}, "choice :- rule(choice(_),_). shown(X) :- output(X,_). #show choice/0. #show shown/1.");
+            ctl.register_reifier(meta, "base");
+            ctl.add("base", {}, "{a}.");
+            ctl.ground({{"base", {}}});
+            REQUIRE(test_solve(ctl.solve(), models).is_satisfiable());
+            REQUIRE(models.size() == 2);
+            meta.ground({{"base", {}}});
+            test_solve(meta.solve(), models);
+            SymbolVector expected{Id("choice"), Function("shown", {Id("a")})};
+            std::sort(expected.begin(), expected.end());
+            REQUIRE(models == ModelVec({expected}));
+            REQUIRE(messages.empty());
+        }
         SECTION("model-add-clause") {
             ctl.add("base", {}, "1{a;b}1.");
             ctl.ground({{"base", {}}});
@@ -397,6 +428,23 @@ TEST_CASE("solving", "[clingo]") {
             for (auto it = atoms.begin(Signature("p", 1)); it; ++it) { symbols.emplace_back(it->symbol()); }
             std::sort(symbols.begin(), symbols.end());
             REQUIRE(symbols == SymbolVector({p1, p2, p3}));
+            auto exported = atoms.export_atoms();
+            REQUIRE(exported.symbols.size() == 4);
+            REQUIRE(exported.literals.size() == 4);
+            REQUIRE(exported.flags.size() == 4);
+            size_t i = 0;
+            for (auto atom : atoms) {
+                REQUIRE(exported.symbols[i] == atom.symbol());
+                REQUIRE(exported.literals[i] == atom.literal());
+                REQUIRE(((exported.flags[i] & SymbolicAtomFlags::Fact) != 0) == atom.is_fact());
+                REQUIRE(((exported.flags[i] & SymbolicAtomFlags::External) != 0) == atom.is_external());
+                ++i;
+            }
+            exported = atoms.export_atoms(Signature("p", 1));
+            symbols = exported.symbols;
+            std::sort(symbols.begin(), symbols.end());
+            REQUIRE(symbols == SymbolVector({p1, p2, p3}));
+            REQUIRE(atoms.export_atoms(Signature("r", 1)).symbols.empty());
         }
         SECTION("incremental") {
             ctl.add("base", {}, "#external query(0).");
@@ -521,6 +569,65 @@ TEST_CASE("solving", "[clingo]") {
             ctl.add("base", {}, "a(@f()).");
             REQUIRE_THROWS_AS(ctl.ground({{"base", {}}}, [](Location, char const *, SymbolSpan, SymbolSpanCallback) { throw std::runtime_error("fail"); }), std::runtime_error);
         }
+        SECTION("ground async") {
+            // without thread support, grounding happens in the calling thread
+            auto caller = std::this_thread::get_id();
+            bool async = false;
+            std::promise<void> started, release;
+            auto released = release.get_future().share();
+            ctl.add("base", {}, "a(@f()). b(X) :- a(X).");
+            auto handle = ctl.ground_async({{"base", {}}}, [&](Location, char const *, SymbolSpan, SymbolSpanCallback report) {
+                async = std::this_thread::get_id() != caller;
+                started.set_value();
+                if (async) { released.wait(); }
+                report({Number(1)});
+            });
+            started.get_future().wait();
+            if (async) {
+                REQUIRE(!handle.wait(0));
+                REQUIRE(handle.progress() == 0);
+                REQUIRE_THROWS_AS(ctl.add("base", {}, "c."), std::runtime_error);
+                REQUIRE_THROWS_AS(ctl.solve(), std::runtime_error);
+                release.set_value();
+                REQUIRE(handle.get());
+                REQUIRE(handle.progress() >= 2);
+            }
+            REQUIRE(handle.get());
+            REQUIRE(test_solve(ctl.solve(), models).is_satisfiable());
+            REQUIRE(models == ModelVec({{Function("a", {Number(1)}), Function("b", {Number(1)})}}));
+        }
+        SECTION("ground async cancel") {
+            auto caller = std::this_thread::get_id();
+            bool async = false;
+            std::promise<void> started, release;
+            auto released = release.get_future().share();
+            ctl.add("base", {}, "a(@f()). b(X) :- a(X).");
+            auto handle = ctl.ground_async({{"base", {}}}, [&](Location, char const *, SymbolSpan, SymbolSpanCallback report) {
+                async = std::this_thread::get_id() != caller;
+                started.set_value();
+                if (async) { released.wait(); }
+                report({Number(1)});
+            });
+            started.get_future().wait();
+            if (async) {
+                std::thread releaser([&release]() {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    release.set_value();
+                });
+                handle.cancel();
+                releaser.join();
+                REQUIRE(!handle.get());
+            }
+            // the step is finished with the rules grounded so far
+            REQUIRE(test_solve(ctl.solve(), models).is_satisfiable());
+            REQUIRE(models.size() == 1);
+            REQUIRE((std::find(models.front().begin(), models.front().end(), Function("a", {Number(1)})) == models.front().end()) == async);
+            ctl.add("next", {}, "d.");
+            ctl.ground({{"next", {}}});
+            REQUIRE(test_solve(ctl.solve(), models).is_satisfiable());
+            REQUIRE(models.size() == 1);
+            REQUIRE(std::find(models.front().begin(), models.front().end(), Id("d")) != models.front().end());
+        }
         SECTION("ground program observer") {
             std::vector<std::string> trail;
             Observer obs(trail);
@@ -560,6 +667,24 @@ TEST_CASE("solving", "[clingo]") {
                 REQUIRE(f == 1);
         }
     }
+    SECTION("with pipelined control") {
+        MessageVec messages;
+        ModelVec models;
+        Control ctl{{"0", "--pipeline"}, [&messages](WarningCode code, char const *msg) { messages.emplace_back(code, msg); }, 20};
+        ctl.add("base", {}, "p(1..100). {q(X)} :- p(X), X < 3. #external e. #show q/1. #show e/0.");
+        ctl.ground({{"base", {}}});
+        auto atoms = ctl.symbolic_atoms();
+        REQUIRE(atoms.find(Id("e"))->is_external());
+        REQUIRE(test_solve(ctl.solve(), models).is_satisfiable());
+        REQUIRE(models.size() == 4);
+        ctl.assign_external(Id("e"), TruthValue::True);
+        ctl.add("step", {}, "r :- q(1).");
+        ctl.ground({{"step", {}}});
+        REQUIRE(test_solve(ctl.solve(), models).is_satisfiable());
+        REQUIRE(models.size() == 4);
+        REQUIRE(std::all_of(models.begin(), models.end(), [](SymbolVector const &m) { return std::find(m.begin(), m.end(), Id("e")) != m.end(); }));
+        REQUIRE(messages.empty());
+    }
 }
 
 } } // namespace Test Clingo
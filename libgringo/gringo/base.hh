@@ -27,7 +27,9 @@
 
 #include <cassert>
 #include <gringo/term.hh>
+#include <gringo/hash_set.hh>
 #include <deque>
+#include <unordered_map>
 
 namespace Gringo {
 
@@ -43,9 +45,97 @@ public:
     virtual bool callable(String name) = 0;
     virtual SymVec call(Location const &loc, String name, SymSpan args, Logger &log) = 0;
     virtual void exec(ScriptType type, Location loc, String code) = 0;
+    //! Whether the result of the given function only depends on its arguments.
+    //! Calls to pure functions can be memoized by a MemoContext.
+    virtual bool pure(String) { return false; }
+    //! Whether the given function should be called with many argument tuples at once.
+    virtual bool batchable(String) { return false; }
+    //! Call a function once for a list of argument tuples.
+    //! Returns one list of symbols per tuple. The default implementation calls
+    //! the function separately for each tuple.
+    virtual std::vector<SymVec> callBatch(Location const &loc, String name, std::vector<SymVec> const &args, Logger &log);
     virtual ~Context() noexcept = default;
 };
 
+// {{{1 declaration of MemoContext
+
+//! Context memoizing calls to pure functions of another context.
+//!
+//! Results are stored in a ring buffer indexed by function name and
+//! arguments. Once the number of stored results reaches the limit, the oldest
+//! result is replaced; a limit of zero disables memoization.
+class MemoContext : public Context {
+public:
+    MemoContext(Context &ctx, size_t limit = 1000000)
+    : ctx_(ctx)
+    , limit_(limit) { }
+    bool callable(String name) override { return ctx_.callable(name); }
+    bool pure(String name) override;
+    bool batchable(String name) override;
+    SymVec call(Location const &loc, String name, SymSpan args, Logger &log) override;
+    std::vector<SymVec> callBatch(Location const &loc, String name, std::vector<SymVec> const &args, Logger &log) override;
+    void exec(ScriptType type, Location loc, String code) override;
+    //! Recheck which functions are pure or batchable on their next call.
+    //! Must be called whenever the functions provided by the underlying
+    //! context might have changed. Results of functions that are still pure
+    //! are kept.
+    void reset();
+    //! Remove all memoized results.
+    void clear();
+    void setLimit(size_t limit);
+    //! The number of calls answered from memoized results.
+    size_t hits() const { return hits_; }
+    //! The number of calls to pure functions that had to be evaluated.
+    size_t misses() const { return misses_; }
+    //! The number of currently memoized results.
+    size_t size() const { return entries_.size(); }
+    virtual ~MemoContext() noexcept = default;
+
+private:
+    struct Function {
+        bool checked = false;
+        bool pure = false;
+        bool batchable = false;
+    };
+    struct Entry {
+        String name;
+        SymVec args;
+        SymVec result;
+    };
+    using Entries = std::vector<Entry>;
+    // the index stores offsets into the entries and can be probed with a
+    // name and argument span without copying the arguments
+    struct EntryHash {
+        size_t operator()(uint32_t offset) const;
+        size_t operator()(String name, SymSpan args) const;
+        Entries const &entries;
+    };
+    struct EntryEqualTo {
+        bool operator()(uint32_t a, uint32_t b) const;
+        bool operator()(uint32_t offset, String name, SymSpan args) const;
+        Entries const &entries;
+    };
+    Function &function(String name);
+    Entry const *find(String name, SymSpan args);
+    void store(String name, SymSpan args, SymVec const &result);
+    //! Remove all results of the given function.
+    void forget(String name);
+    //! Move the oldest entry to the front.
+    void rotate();
+    //! Rebuild the index dropping deleted slots.
+    void reindex();
+
+    Context &ctx_;
+    std::unordered_map<String, Function> functions_;
+    Entries entries_;
+    HashSet<uint32_t> index_;
+    size_t next_ = 0;
+    size_t erased_ = 0;
+    size_t limit_;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+};
+
 // {{{1 declaration of TheoryAtomType
 
 enum class TheoryAtomType { Head, Body, Any, Directive };
@@ -264,6 +354,185 @@ struct clone<Bound> {
     }
 };
 
+// {{{1 definition of Context
+
+inline std::vector<SymVec> Context::callBatch(Location const &loc, String name, std::vector<SymVec> const &args, Logger &log) {
+    std::vector<SymVec> ret;
+    ret.reserve(args.size());
+    for (auto &x : args) { ret.emplace_back(call(loc, name, Potassco::toSpan(x), log)); }
+    return ret;
+}
+
+// {{{1 definition of MemoContext
+
+inline size_t MemoContext::EntryHash::operator()(uint32_t offset) const {
+    auto &entry = entries[offset];
+    return (*this)(entry.name, Potassco::toSpan(entry.args));
+}
+
+inline size_t MemoContext::EntryHash::operator()(String name, SymSpan args) const {
+    size_t seed = name.hash();
+    for (auto &x : args) { hash_combine(seed, x.hash()); }
+    return seed;
+}
+
+inline bool MemoContext::EntryEqualTo::operator()(uint32_t a, uint32_t b) const {
+    auto &entry = entries[b];
+    return (*this)(a, entry.name, Potassco::toSpan(entry.args));
+}
+
+inline bool MemoContext::EntryEqualTo::operator()(uint32_t offset, String name, SymSpan args) const {
+    auto &entry = entries[offset];
+    return entry.name == name && entry.args.size() == args.size && std::equal(begin(args), end(args), entry.args.begin());
+}
+
+inline MemoContext::Function &MemoContext::function(String name) {
+    auto &fun = functions_[name];
+    if (!fun.checked) {
+        fun.checked = true;
+        bool callable = ctx_.callable(name);
+        fun.pure = callable && ctx_.pure(name);
+        fun.batchable = callable && ctx_.batchable(name);
+        if (!fun.pure) { forget(name); }
+    }
+    return fun;
+}
+
+inline MemoContext::Entry const *MemoContext::find(String name, SymSpan args) {
+    auto *offset = index_.find(EntryHash{entries_}, EntryEqualTo{entries_}, name, args);
+    return offset ? &entries_[*offset] : nullptr;
+}
+
+inline void MemoContext::store(String name, SymSpan args, SymVec const &result) {
+    EntryHash hash{entries_};
+    EntryEqualTo equalTo{entries_};
+    if (entries_.size() < limit_) {
+        entries_.push_back({name, SymVec(begin(args), end(args)), result});
+        index_.insert(hash, equalTo, static_cast<uint32_t>(entries_.size() - 1));
+    }
+    else {
+        // replace the oldest entry reusing its storage
+        auto offset = static_cast<uint32_t>(next_);
+        index_.erase(hash, equalTo, offset);
+        auto &entry = entries_[offset];
+        entry.name = name;
+        entry.args.assign(begin(args), end(args));
+        entry.result = result;
+        index_.insert(hash, equalTo, offset);
+        next_ = (next_ + 1) % entries_.size();
+        // erasing leaves deleted slots behind that slow down probing
+        if (++erased_ * 2 > index_.reserved() - index_.size()) { reindex(); }
+    }
+}
+
+inline void MemoContext::forget(String name) {
+    auto match = [name](Entry const &entry) { return entry.name == name; };
+    if (std::none_of(entries_.begin(), entries_.end(), match)) { return; }
+    rotate();
+    entries_.erase(std::remove_if(entries_.begin(), entries_.end(), match), entries_.end());
+    reindex();
+}
+
+inline void MemoContext::rotate() {
+    std::rotate(entries_.begin(), entries_.begin() + next_, entries_.end());
+    next_ = 0;
+}
+
+inline void MemoContext::reindex() {
+    erased_ = 0;
+    index_.clear();
+    EntryHash hash{entries_};
+    EntryEqualTo equalTo{entries_};
+    for (uint32_t i = 0, e = static_cast<uint32_t>(entries_.size()); i != e; ++i) {
+        index_.insert(hash, equalTo, i);
+    }
+}
+
+inline bool MemoContext::pure(String name) {
+    return function(name).pure;
+}
+
+inline bool MemoContext::batchable(String name) {
+    return function(name).batchable;
+}
+
+inline SymVec MemoContext::call(Location const &loc, String name, SymSpan args, Logger &log) {
+    if (limit_ == 0) { return ctx_.call(loc, name, args, log); }
+    auto &fun = function(name);
+    if (!fun.pure) { return ctx_.call(loc, name, args, log); }
+    if (auto *entry = find(name, args)) {
+        ++hits_;
+        return entry->result;
+    }
+    ++misses_;
+    SymVec ret = ctx_.call(loc, name, args, log);
+    store(name, args, ret);
+    return ret;
+}
+
+inline std::vector<SymVec> MemoContext::callBatch(Location const &loc, String name, std::vector<SymVec> const &args, Logger &log) {
+    if (limit_ == 0) { return ctx_.callBatch(loc, name, args, log); }
+    auto &fun = function(name);
+    if (!fun.pure) { return ctx_.callBatch(loc, name, args, log); }
+    // only the tuples without memoized result are passed on
+    std::vector<SymVec> ret(args.size());
+    std::vector<SymVec> missing;
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < args.size(); ++i) {
+        if (auto *entry = find(name, Potassco::toSpan(args[i]))) {
+            ++hits_;
+            ret[i] = entry->result;
+        }
+        else {
+            missing.emplace_back(args[i]);
+            indices.emplace_back(i);
+        }
+    }
+    if (!missing.empty()) {
+        misses_ += missing.size();
+        auto results = ctx_.callBatch(loc, name, missing, log);
+        for (size_t i = 0; i < missing.size(); ++i) {
+            auto span = Potassco::toSpan(missing[i]);
+            if (!find(name, span)) { store(name, span, results[i]); }
+            ret[indices[i]] = std::move(results[i]);
+        }
+    }
+    return ret;
+}
+
+inline void MemoContext::exec(ScriptType type, Location loc, String code) {
+    // executing code might redefine functions
+    clear();
+    reset();
+    ctx_.exec(type, loc, code);
+}
+
+inline void MemoContext::reset() {
+    for (auto &fun : functions_) { fun.second.checked = false; }
+}
+
+inline void MemoContext::clear() {
+    entries_.clear();
+    index_.clear();
+    next_ = 0;
+    erased_ = 0;
+}
+
+inline void MemoContext::setLimit(size_t limit) {
+    limit_ = limit;
+    if (entries_.size() > limit_) {
+        // keep the most recent results
+        rotate();
+        entries_.erase(entries_.begin(), entries_.begin() + (entries_.size() - limit_));
+        reindex();
+    }
+    else if (next_ != 0) {
+        // restore insertion order so that the buffer can grow
+        rotate();
+        reindex();
+    }
+}
+
 // }}}1
 
 } // namespace Gringo
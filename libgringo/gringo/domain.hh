@@ -61,6 +61,27 @@ public:
 
 using SValVec = std::vector<Term::SVal>;
 
+// }}}
+// {{{ declaration of PartitionKey
+
+// Atoms in a domain can be partitioned by the value of one of their arguments.
+// An index whose representation fixes an argument to a ground value only has
+// to import atoms from the matching partition. In incremental programs, this
+// is typically the step parameter, e.g., holds(F,5) in a step(5) program.
+using PartitionKey = std::pair<Id_t, Symbol>;
+
+// Returns the position and value of the last ground argument of a function term.
+// The position is InvalidId if there is no such argument.
+inline PartitionKey partitionKey(Term const &repr) {
+    if (auto fun = dynamic_cast<FunctionTerm const *>(&repr)) {
+        for (auto i = fun->args.size(); i-- > 0; ) {
+            Symbol val = fun->args[i]->isEDB();
+            if (val.type() != SymbolType::Special) { return {static_cast<Id_t>(i), val}; }
+        }
+    }
+    return {InvalidId, Symbol()};
+}
+
 // }}}
 // {{{ declaration of BindIndex
 
@@ -146,7 +167,7 @@ public:
     using Index     = UniqueVec<Entry, typename Entry::Hash, EqualTo>;
 
     struct OffsetRange {
-        bool next(Id_t &offset, Term const &repr, BindIndex &idx) {
+        bool next(Id_t &offset, FlatMatcher const &repr, BindIndex &idx) {
             if (current != end) {
                 offset = *current++;
                 repr.match(idx.domain_[offset]);
@@ -160,13 +181,15 @@ public:
 
     BindIndex(Domain &domain, SValVec &&bound, UTerm &&repr)
     : repr_(std::move(repr))
+    , matcher_(*repr_)
+    , key_(partitionKey(*repr_))
     , domain_(domain)
     , bound_(std::move(bound)) {
         assert(!bound_.empty());
     }
 
     bool update() override {
-        return domain_.update([this](SizeType offset) { add(offset); }, *repr_, imported_, importedDelayed_);
+        return domain_.update([this](SizeType offset) { add(offset); }, matcher_, key_, imported_, importedDelayed_);
     }
 
     // Returns a range of offsets corresponding to atoms that match the given bound variables.
@@ -207,13 +230,15 @@ private:
     }
 
 private:
-    UTerm const repr_;
-    Domain     &domain_;
-    SValVec     bound_;
-    SymVec      boundVals_;
-    Index       data_;
-    Id_t        imported_ = 0;
-    Id_t        importedDelayed_ = 0;
+    UTerm const  repr_;
+    FlatMatcher  matcher_;
+    PartitionKey key_;
+    Domain      &domain_;
+    SValVec      bound_;
+    SymVec       boundVals_;
+    Index        data_;
+    Id_t         imported_ = 0;
+    Id_t         importedDelayed_ = 0;
 };
 
 // }}}
@@ -230,7 +255,7 @@ public:
     using Iterator    = typename IntervalVec::iterator;
 
     struct OffsetRange {
-        bool next(SizeType &offset, Term const &repr, FullIndex &idx) {
+        bool next(SizeType &offset, FlatMatcher const &repr, FullIndex &idx) {
             // For Old and All atoms, iterate forward until the atoms in the index are exceeded.
             // For Old atoms stop early if the atoms do not belong to previous generations anymore.
             if (type != BinderType::NEW) {
@@ -283,6 +308,8 @@ public:
     // This is used to implement projection in the incremental case.
     FullIndex(Domain &domain, UTerm &&repr, Id_t imported)
     : repr_(std::move(repr))
+    , matcher_(*repr_)
+    , key_(partitionKey(*repr_))
     , domain_(domain)
     , imported_(imported)
     , initialImport_(imported) { }
@@ -298,7 +325,7 @@ public:
     }
 
     bool update() override {
-        return domain_.update([this](SizeType offset) { add(offset); return true; }, *repr_, imported_, importedDelayed_);
+        return domain_.update([this](SizeType offset) { add(offset); return true; }, matcher_, key_, imported_, importedDelayed_);
     }
 
     bool operator==(FullIndex const &x) const {
@@ -325,12 +352,125 @@ private:
     }
 
 private:
-    UTerm       repr_;
-    Domain     &domain_;
-    IntervalVec index_;
-    Id_t        imported_;
-    Id_t        importedDelayed_ = 0;
-    Id_t        initialImport_;
+    UTerm        repr_;
+    FlatMatcher  matcher_;
+    PartitionKey key_;
+    Domain      &domain_;
+    IntervalVec  index_;
+    Id_t         imported_;
+    Id_t         importedDelayed_ = 0;
+    Id_t         initialImport_;
+};
+
+// }}}
+// {{{ declaration of SortedIndex
+
+// A bound on an argument of an atom of form arg rel term.
+using IndexBound    = std::pair<Relation, Term const *>;
+using IndexBoundVec = std::vector<IndexBound>;
+
+// An index for a positive literal occurrence with all variables unbound.
+// The matches are sorted by the argument at a given position.
+// This allows for restricting the matches to the atoms whose argument
+// satisfies the bounds given by comparison literals.
+template <class Domain>
+class SortedIndex : public IndexUpdater {
+public:
+    using SizeType = typename Domain::SizeType;
+    using Entry    = std::pair<Symbol, SizeType>;
+    using EntryVec = std::vector<Entry>;
+
+    struct OffsetRange {
+        // Unlike in the other indices, atoms are not ordered by generation.
+        // Hence, atoms of the current generation are skipped for OLD binders.
+        bool next(SizeType &offset, FlatMatcher const &repr, SortedIndex &idx) {
+            for (; current != end; ++current) {
+                offset = idx.index_[current].second;
+                auto &atom = idx.domain_[offset];
+                if (type == BinderType::OLD && atom.generation() >= idx.domain_.generation()) { continue; }
+                ++current;
+                repr.match(atom);
+                return true;
+            }
+            return false;
+        }
+        BinderType type;
+        SizeType current;
+        SizeType end;
+    };
+
+    SortedIndex(Domain &domain, UTerm &&repr, Id_t position)
+    : repr_(std::move(repr))
+    , matcher_(*repr_)
+    , key_(partitionKey(*repr_))
+    , domain_(domain)
+    , position_(position) { }
+
+    // Returns a range of offsets corresponding to matching atoms within the given bounds.
+    // If a bound is undefined, the range is empty because the comparison literal
+    // would fail for all atoms; the undefined operation is reported here instead.
+    // Script calls have been replaced by variables bound by script literals,
+    // so evaluating the bounds does not call scripts.
+    // The index is not used for NEW binders because it would have to skip all old atoms in the range.
+    OffsetRange lookup(IndexBoundVec const &bounds, BinderType type, Logger &log) {
+        assert(type != BinderType::NEW);
+        auto lt = [](Entry const &a, Symbol const &b) { return a.first < b; };
+        auto gt = [](Symbol const &a, Entry const &b) { return a < b.first; };
+        auto begin = index_.begin(), end = index_.end();
+        for (auto &bound : bounds) {
+            if (begin == end) { break; }
+            bool undefined = false;
+            Symbol val = bound.second->eval(undefined, log);
+            if (undefined) {
+                end = begin;
+                break;
+            }
+            switch (bound.first) {
+                case Relation::LT:  { end   = std::lower_bound(begin, end, val, lt); break; }
+                case Relation::LEQ: { end   = std::upper_bound(begin, end, val, gt); break; }
+                case Relation::GT:  { begin = std::upper_bound(begin, end, val, gt); break; }
+                case Relation::GEQ: { begin = std::lower_bound(begin, end, val, lt); break; }
+                case Relation::NEQ:
+                case Relation::EQ:  { assert(false); break; }
+            }
+        }
+        return { type, static_cast<SizeType>(begin - index_.begin()), static_cast<SizeType>(end - index_.begin()) };
+    }
+
+    // Imports new atoms and merges them into the sorted entries.
+    bool update() override {
+        auto size = index_.size();
+        bool ret = domain_.update([this](SizeType offset) {
+            Symbol atom = domain_[offset];
+            index_.emplace_back(atom.args()[position_], offset);
+        }, matcher_, key_, imported_, importedDelayed_);
+        if (index_.size() > size) {
+            auto mid = index_.begin() + size;
+            std::sort(mid, index_.end());
+            std::inplace_merge(index_.begin(), mid, index_.end());
+        }
+        return ret;
+    }
+
+    bool operator==(SortedIndex const &x) const {
+        return *repr_ == *x.repr_ && position_ == x.position_;
+    }
+
+    size_t hash() const {
+        return get_value_hash(repr_, position_);
+    }
+
+    virtual ~SortedIndex() noexcept = default;
+
+private:
+    UTerm        repr_;
+    FlatMatcher  matcher_;
+    PartitionKey key_;
+    Domain      &domain_;
+    EntryVec     index_;
+    Id_t         position_;
+    Id_t         imported_ = 0;
+    Id_t         importedDelayed_ = 0;
 };
 
 // }}}
@@ -365,11 +505,18 @@ public:
     using FullIndex       = Gringo::FullIndex<AbstractDomain>;
     using BindIndices     = std::unordered_set<BindIndex, call_hash<BindIndex>>;
     using FullIndices     = std::unordered_set<FullIndex, call_hash<FullIndex>>;
+    using SortedIndex     = Gringo::SortedIndex<AbstractDomain>;
+    using SortedIndices   = std::unordered_set<SortedIndex, call_hash<SortedIndex>>;
     using AtomVec         = typename Atoms::Vec;
     using Iterator        = typename AtomVec::iterator;
     using ConstIterator   = typename AtomVec::const_iterator;
     using SizeType        = typename Atoms::SizeType;
     using OffsetVec       = std::vector<SizeType>;
+    struct Partition {
+        std::unordered_map<Symbol, OffsetVec> offsets;
+        SizeType imported = 0;
+    };
+    using Partitions      = std::unordered_map<Id_t, Partition>;
 
     AbstractDomain() = default;
     AbstractDomain(AbstractDomain const &) = delete;
@@ -390,6 +537,13 @@ public:
         return idx;
     }
 
+    SortedIndex &addSorted(UTerm &&repr, Id_t position) {
+        auto ret(sortedIndices_.emplace(*this, std::move(repr), position));
+        auto &idx = const_cast<SortedIndex&>(*ret.first);
+        idx.update();
+        return idx;
+    }
+
     // Function to lookup negative literals or non-recursive atoms.
     bool lookup(SizeType &offset, Term const &repr, RECNAF naf, Logger &log) {
         bool undefined = false;
@@ -480,8 +634,9 @@ public:
     // Returns true if a maching atom was falls.
     // Furthermore, accepts a callback f that receives the offset of a matching atom.
     // If the callback returns false the search for matching atoms is stopped and the function returns true.
-    template <typename F>
-    bool update(F f, Term const &repr, SizeType &imported, SizeType &importedDelayed) {
+    // The representation can be a Term or a FlatMatcher.
+    template <typename F, typename Repr>
+    bool update(F f, Repr const &repr, SizeType &imported, SizeType &importedDelayed) {
         bool ret = false;
         for (auto it(atoms_.begin() + imported), ie(atoms_.end()); it < ie; ++it, ++imported) {
             if (it->defined()) {
@@ -503,15 +658,60 @@ public:
         return ret;
     }
 
+    // Like the function above but first imports atoms from the partition
+    // given by the key. This avoids traversing the whole domain when a fresh
+    // index is created for a representation with a fixed argument.
+    template <typename F, typename Repr>
+    bool update(F f, Repr const &repr, PartitionKey const &key, SizeType &imported, SizeType &importedDelayed) {
+        bool ret = false;
+        if (key.first != InvalidId) {
+            auto &part = partition(key.first);
+            auto it = part.offsets.find(key.second);
+            if (it != part.offsets.end()) {
+                for (auto jt = std::lower_bound(it->second.begin(), it->second.end(), imported), je = it->second.end(); jt != je; ++jt) {
+                    auto &atom = operator[](*jt);
+                    if (atom.defined() && !atom.delayed() && repr.match(atom)) {
+                        ret = true;
+                        f(*jt);
+                    }
+                }
+            }
+            imported = std::max(imported, part.imported);
+        }
+        return update(f, repr, imported, importedDelayed) || ret;
+    }
+
+    // Returns the partition of the atoms w.r.t. the argument at the given position.
+    // Partitions are created on demand and extended with atoms added in the meantime.
+    // Like in the update function, undefined atoms are marked as delayed
+    // because indices importing from the partition skip them.
+    Partition &partition(Id_t position) {
+        auto &part = partitions_[position];
+        for (auto it(atoms_.begin() + part.imported), ie(atoms_.end()); it < ie; ++it, ++part.imported) {
+            if (!it->defined()) { it->markDelayed(); }
+            Symbol sym = *it;
+            if (sym.type() == SymbolType::Fun && position < sym.args().size) {
+                part.offsets[sym.args()[position]].emplace_back(part.imported);
+            }
+        }
+        return part;
+    }
+    Partitions const &partitions() const { return partitions_; }
+
     void clear() {
         atoms_.clear();
         indices_.clear();
         fullIndices_.clear();
+        sortedIndices_.clear();
+        partitions_.clear();
         generation_ = 0;
     }
+    // Removes all indices; partitions are kept because
+    // they do not depend on the atoms imported by the indices.
     void reset() {
         indices_.clear();
         fullIndices_.clear();
+        sortedIndices_.clear();
     }
 
     // Returns the current generation.
@@ -585,15 +785,17 @@ protected:
     void hide(Iterator it) { atoms_.hide(it); }
 
 protected:
-    BindIndices indices_;
-    FullIndices fullIndices_;
-    Atoms       atoms_;
-    OffsetVec   delayed_;
-    Id_t        enqueued_ = 0;
-    Id_t        generation_ = 0;
-    Id_t        initOffset_ = 0;
-    Id_t        initDelayedOffset_ = 0;
-    Id_t        domainOffset_ = InvalidId;
+    BindIndices   indices_;
+    FullIndices   fullIndices_;
+    SortedIndices sortedIndices_;
+    Partitions    partitions_;
+    Atoms         atoms_;
+    OffsetVec     delayed_;
+    Id_t          enqueued_ = 0;
+    Id_t          generation_ = 0;
+    Id_t          initOffset_ = 0;
+    Id_t          initDelayedOffset_ = 0;
+    Id_t          domainOffset_ = InvalidId;
 };
 
 // }}}
@@ -40,6 +40,7 @@ struct PosBinder : Binder {
     using Lookup    = std::tuple<Index, LookupArgs...>;
     PosBinder(UTerm &&repr, Match &result, Index &&index, BinderType type, LookupArgs&&... args)
         : repr(std::move(repr))
+        , matcher(*this->repr)
         , result(result)
         , index(std::forward<Index>(index), std::forward<LookupArgs>(args)...)
         , type(type) { }
@@ -54,15 +55,16 @@ struct PosBinder : Binder {
 
     IndexUpdater *getUpdater() override          { return &std::get<0>(index); }
     void match(Logger &log) override     { current = lookup<sizeof...(LookupArgs)>()(index, type, log); }
-    bool next() override                         { return current.next(result, *repr, std::get<0>(index)); }
+    bool next() override                         { return current.next(result, matcher, std::get<0>(index)); }
     void print(std::ostream &out) const override { out << *repr << "@" << type; }
     virtual ~PosBinder()                         { }
 
-    UTerm      repr; // problematic
-    Match     &result;
-    Lookup     index;
-    MatchRng   current;
-    BinderType type;
+    UTerm       repr; // problematic
+    FlatMatcher matcher;
+    Match      &result;
+    Lookup      index;
+    MatchRng    current;
+    BinderType  type;
 };
 
 // }}}
@@ -111,6 +113,7 @@ struct PosMatcher : Binder, IndexUpdater {
         : result(result)
         , domain(domain)
         , repr(std::move(repr))
+        , matcher(*this->repr)
         , type(type) { }
     IndexUpdater *getUpdater() override { return type == BinderType::NEW ? this : nullptr; }
     void match(Logger &log) override {
@@ -121,13 +124,14 @@ struct PosMatcher : Binder, IndexUpdater {
         firstMatch = false;
         return ret;
     }
-    bool update() override { return domain.update([](unsigned) { }, *repr, imported, importedDelayed); }
+    bool update() override { return domain.update([](unsigned) { }, matcher, imported, importedDelayed); }
     void print(std::ostream &out) const override { out << *repr << "[" << domain.generation() << "/" << domain.size() << "]" << "@" << type; }
     virtual ~PosMatcher() { };
 
     Match      &result;
     DomainType &domain;
     UTerm       repr;
+    FlatMatcher matcher;
     BinderType  type;
     unsigned    imported = 0;
     unsigned    importedDelayed = 0;
@@ -201,6 +205,27 @@ inline UIdx make_binder(AbstractDomain<Atom> &domain, NAF naf, Term const &repr,
     }
 }
 
+// }}}
+// {{{ definition of make_sorted_binder
+
+// Creates a binder for a positive literal with all variables unbound
+// that only matches atoms whose argument at the given position satisfies the bounds.
+template <class Atom>
+inline UIdx make_sorted_binder(AbstractDomain<Atom> &domain, Term const &repr, typename AbstractDomain<Atom>::SizeType &elem, BinderType type, Term::VarSet &bound, Id_t position, IndexBoundVec &&bounds) {
+    using DomainType            = AbstractDomain<Atom>;
+    using SortedPredicateBinder = PosBinder<typename DomainType::SortedIndex&, IndexBoundVec>;
+    UTerm predClone(repr.clone());
+    VarTermBoundVec occs;
+    predClone->collect(occs, false);
+    for (auto &x : occs) { x.first->bindRef = bound.emplace(x.first->name).second; }
+    Term::RenameMap rename;
+    UTerm idxClone(predClone->renameVars(rename));
+    Term::VarSet empty;
+    idxClone->bind(empty);
+    auto &idx(domain.addSorted(std::move(idxClone), position));
+    return gringo_make_unique<SortedPredicateBinder>(std::move(predClone), elem, idx, type, std::move(bounds));
+}
+
 // }}}
 
 } } // namespace Ground Gringo
@@ -26,9 +26,37 @@
 #define _GRINGO_GROUND_INSTANTIATION_HH
 
 #include <gringo/output/types.hh>
+#include <atomic>
 
 namespace Gringo { namespace Ground {
 
+// {{{ declaration of GroundProgress
+
+// Thrown at a cancellation point after grounding has been cancelled.
+class GroundCancelled : public std::runtime_error {
+public:
+    GroundCancelled() : std::runtime_error("grounding stopped because it was cancelled") { }
+};
+
+// Allows for observing and cancelling grounding from another thread.
+// Only the grounding thread advances the progress.
+class GroundProgress {
+public:
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+    bool cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+    // The number of rule instances reported so far.
+    uint64_t instances() const { return instances_.load(std::memory_order_relaxed); }
+    void report() { instances_.store(instances_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+    // Cancellation point.
+    void check() const {
+        if (cancelled()) { throw GroundCancelled(); }
+    }
+private:
+    std::atomic<bool> cancelled_{false};
+    std::atomic<uint64_t> instances_{0};
+};
+
+// }}}
 // {{{ declaration of Queue
 
 struct Instantiator;
@@ -43,6 +71,7 @@ struct Queue {
     QueueDec  current;
     std::array<QueueDec,2>  queues;
     DomainVec domains;
+    GroundProgress *progress = nullptr;
 };
 
 // }}}
@@ -52,6 +81,16 @@ struct Binder : Printable {
     virtual IndexUpdater *getUpdater() = 0;
     virtual void match(Logger &log) = 0;
     virtual bool next() = 0;
+    // Start collecting the arguments of script calls instead of calling
+    // scripts while matching; returns whether the binder batches calls.
+    virtual bool beginBatch() { return false; }
+    // Call scripts for the collected arguments and return whether there were any.
+    virtual bool flushBatch(Logger &) { return false; }
+    // Stop collecting arguments; results of the batched calls are used while matching.
+    virtual void endBatch() { }
+    // Whether the binder calls a script function that cannot be batched.
+    // Rules with such calls are not batched because dry runs would repeat them.
+    virtual bool unbatchedCalls() { return false; }
     virtual ~Binder() { }
 };
 using UIdx = std::unique_ptr<Binder>;
@@ -111,7 +150,9 @@ struct Instantiator {
     void add(UIdx &&index, DependVec &&depends);
     void finalize(DependVec &&depends);
     void enqueue(Queue &queue);
-    void instantiate(Output::OutputBase &out, Logger &log);
+    void instantiate(Output::OutputBase &out, Logger &log, GroundProgress *progress = nullptr);
+    // Enumerates all instances; they are only reported if report is true.
+    void enumerate(Output::OutputBase &out, Logger &log, GroundProgress *progress, bool report);
     void print(std::ostream &out) const;
     unsigned priority() const;
     ~Instantiator() noexcept;
@@ -41,6 +41,18 @@ public:
 
 // }}}
 
+// {{{ declaration of VarBound
+
+// A comparison of form var rel term where var is an unbound variable
+// and all variables in term are bound.
+struct VarBound {
+    String var;
+    Relation rel;
+    Term const &term;
+};
+using VarBoundVec = std::vector<VarBound>;
+
+// }}}
 // {{{ declaration of Literal
 
 using BodyOcc = BodyOccurrence<HeadOccurrence>;
@@ -50,6 +62,10 @@ public:
     virtual bool auxiliary() const = 0;
     virtual bool isRecursive() const = 0;
     virtual UIdx index(Context &context, BinderType type, Term::VarSet &bound) = 0;
+    // Like index but the binder may restrict matches using the given bounds.
+    virtual UIdx rangeIndex(Context &context, BinderType type, Term::VarSet &bound, VarBoundVec const &bounds);
+    // Adds the bounds the literal imposes on unbound variables.
+    virtual void collectBounds(Term::VarSet const &bound, VarBoundVec &bounds) const;
     virtual BodyOcc *occurrence() = 0;
     virtual void collect(VarTermBoundVec &vars) const = 0;
     virtual void collectImportant(Term::VarSet &vars);
@@ -63,6 +63,25 @@ struct RangeLiteral : Literal {
     RangeLiteralShared range;
 };
 
+// }}}
+// {{{ declaration of PoolLiteral
+
+struct PoolLiteral : Literal {
+    PoolLiteral(UTerm &&assign, SymVec &&values);
+    void print(std::ostream &out) const override;
+    bool isRecursive() const override;
+    BodyOcc *occurrence() override;
+    void collect(VarTermBoundVec &vars) const override;
+    UIdx index(Context &context, BinderType type, Term::VarSet &bound) override;
+    std::pair<Output::LiteralId,bool> toOutput(Logger &log) override;
+    Score score(Term::VarSet const &bound, Logger &log) override;
+    bool auxiliary() const override { return true; }
+    virtual ~PoolLiteral();
+
+    UTerm assign;
+    SymVec values;
+};
+
 // }}}
 // {{{ declaration of ScriptLiteral
 
@@ -94,6 +113,7 @@ struct RelationLiteral : Literal {
     BodyOcc *occurrence() override;
     void collect(VarTermBoundVec &vars) const override;
     UIdx index(Context &context, BinderType type, Term::VarSet &bound) override;
+    void collectBounds(Term::VarSet const &bound, VarBoundVec &bounds) const override;
     std::pair<Output::LiteralId,bool> toOutput(Logger &log) override;
     Score score(Term::VarSet const &bound, Logger &log) override;
     bool auxiliary() const override { return true; }
@@ -118,6 +138,7 @@ struct PredicateLiteral : Literal, BodyOcc {
     void collect(VarTermBoundVec &vars) const override;
     DefinedBy &definedBy() override;
     UIdx index(Context &context, BinderType type, Term::VarSet &bound) override;
+    UIdx rangeIndex(Context &context, BinderType type, Term::VarSet &bound, VarBoundVec const &bounds) override;
     std::pair<Output::LiteralId,bool> toOutput(Logger &log) override;
     Score score(Term::VarSet const &bound, Logger &log) override;
     void checkDefined(LocSet &done, SigSet const &edb, UndefVec &undef) const override;
@@ -137,6 +158,7 @@ struct PredicateLiteral : Literal, BodyOcc {
 struct ProjectionLiteral : PredicateLiteral {
     ProjectionLiteral(bool auxiliary, PredicateDomain &dom, UTerm &&repr, bool initialized);
     UIdx index(Context &context, BinderType type, Term::VarSet &bound) override;
+    UIdx rangeIndex(Context &context, BinderType type, Term::VarSet &bound, VarBoundVec const &bounds) override;
     virtual ~ProjectionLiteral();
     bool initialized_;
 };
@@ -216,7 +216,7 @@ struct TupleHeadAggregate : HeadAggregate {
     void check(ChkLvlVec &lvl, Logger &log) const override;
     void replace(Defines &dx) override;
     CreateHead toGround(ToGroundArg &x, Ground::UStmVec &stms, Ground::RuleType type) const override;
-    void getNeg(std::function<void (Sig)> f) const override;
+    void getHeadSigs(std::function<void (Sig)> f) const override;
     virtual ~TupleHeadAggregate();
 
     AggregateFunction fun;
@@ -242,7 +242,7 @@ struct LitHeadAggregate : HeadAggregate {
     bool hasPool(bool beforeRewrite) const override;
     void check(ChkLvlVec &lvl, Logger &log) const override;
     void replace(Defines &dx) override;
-    void getNeg(std::function<void (Sig)> f) const override;
+    void getHeadSigs(std::function<void (Sig)> f) const override;
     CreateHead toGround(ToGroundArg &x, Ground::UStmVec &stms, Ground::RuleType type) const override;
     virtual ~LitHeadAggregate();
 
@@ -274,7 +274,7 @@ struct Disjunction : HeadAggregate {
     bool hasPool(bool beforeRewrite) const override;
     void check(ChkLvlVec &lvl, Logger &log) const override;
     void replace(Defines &dx) override;
-    void getNeg(std::function<void (Sig)> f) const override;
+    void getHeadSigs(std::function<void (Sig)> f) const override;
     CreateHead toGround(ToGroundArg &x, Ground::UStmVec &stms, Ground::RuleType type) const override;
     virtual ~Disjunction();
 
@@ -303,7 +303,7 @@ struct SimpleHeadLiteral : HeadAggregate {
     void replace(Defines &dx) override;
     CreateHead toGround(ToGroundArg &x, Ground::UStmVec &stms, Ground::RuleType type) const override;
     Symbol isEDB() const override;
-    void getNeg(std::function<void (Sig)> f) const override;
+    void getHeadSigs(std::function<void (Sig)> f) const override;
     virtual ~SimpleHeadLiteral();
 
     ULit lit;
@@ -328,7 +328,7 @@ struct MinimizeHeadLiteral : HeadAggregate {
     bool hasPool(bool beforeRewrite) const override;
     void check(ChkLvlVec &lvl, Logger &log) const override;
     void replace(Defines &x) override;
-    void getNeg(std::function<void (Sig)> f) const override;
+    void getHeadSigs(std::function<void (Sig)> f) const override;
     CreateHead toGround(ToGroundArg &x, Ground::UStmVec &stms, Ground::RuleType type) const override;
     virtual ~MinimizeHeadLiteral();
 
@@ -357,7 +357,7 @@ struct EdgeHeadAtom : HeadAggregate {
     bool hasPool(bool beforeRewrite) const override;
     void check(ChkLvlVec &lvl, Logger &log) const override;
     void replace(Defines &x) override;
-    void getNeg(std::function<void (Sig)> f) const override;
+    void getHeadSigs(std::function<void (Sig)> f) const override;
     CreateHead toGround(ToGroundArg &x, Ground::UStmVec &stms, Ground::RuleType type) const override;
     virtual ~EdgeHeadAtom();
 
@@ -383,7 +383,7 @@ struct ProjectHeadAtom : HeadAggregate {
     bool hasPool(bool beforeRewrite) const override;
     void check(ChkLvlVec &lvl, Logger &log) const override;
     void replace(Defines &x) override;
-    void getNeg(std::function<void (Sig)> f) const override;
+    void getHeadSigs(std::function<void (Sig)> f) const override;
     CreateHead toGround(ToGroundArg &x, Ground::UStmVec &stms, Ground::RuleType type) const override;
     virtual ~ProjectHeadAtom();
 
@@ -408,7 +408,7 @@ struct HeuristicHeadAtom : HeadAggregate {
     bool hasPool(bool beforeRewrite) const override;
     void check(ChkLvlVec &lvl, Logger &log) const override;
     void replace(Defines &x) override;
-    void getNeg(std::function<void (Sig)> f) const override;
+    void getHeadSigs(std::function<void (Sig)> f) const override;
     CreateHead toGround(ToGroundArg &x, Ground::UStmVec &stms, Ground::RuleType type) const override;
     virtual ~HeuristicHeadAtom();
 
@@ -436,7 +436,7 @@ struct ShowHeadLiteral : HeadAggregate {
     bool hasPool(bool beforeRewrite) const override;
     void check(ChkLvlVec &lvl, Logger &log) const override;
     void replace(Defines &x) override;
-    void getNeg(std::function<void (Sig)> f) const override;
+    void getHeadSigs(std::function<void (Sig)> f) const override;
     CreateHead toGround(ToGroundArg &x, Ground::UStmVec &stms, Ground::RuleType type) const override;
     virtual ~ShowHeadLiteral();
 
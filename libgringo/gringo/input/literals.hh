@@ -52,7 +52,7 @@ struct PredicateLiteral : Literal {
     UTerm headRepr() const override;
     bool auxiliary() const override { return auxiliary_; }
     void auxiliary(bool auxiliary) override { auxiliary_ = auxiliary; }
-    void getNeg(std::function<void (Sig)> f) const override;
+    void getHeadSigs(std::function<void (Sig)> f) const override;
     virtual ~PredicateLiteral();
 
     NAF naf;
@@ -95,7 +95,7 @@ struct RelationLiteral : Literal {
     virtual ~RelationLiteral();
     static ULit make(Term::ArithmeticsMap::value_type::value_type &x);
     static ULit make(Literal::AssignVec::value_type &x);
-    void getNeg(std::function<void (Sig)>) const override { }
+    void getHeadSigs(std::function<void (Sig)>) const override { }
 
     Relation rel;
     UTerm left;
@@ -125,13 +125,43 @@ struct RangeLiteral : Literal {
     void auxiliary(bool) override { }
     virtual ~RangeLiteral();
     static ULit make(SimplifyState::DotsMap::value_type &dots);
-    void getNeg(std::function<void (Sig)>) const override { }
+    void getHeadSigs(std::function<void (Sig)>) const override { }
 
     UTerm assign;
     UTerm lower;
     UTerm upper;
 };
 
+// }}}
+// {{{ declaration of PoolLiteral
+
+//! Assigns the assigned term to each of the given values.
+//! This is used to ground pools of symbols without unpooling statements.
+struct PoolLiteral : Literal {
+    PoolLiteral(UTerm &&assign, SymVec &&values);
+    void collect(VarTermBoundVec &vars, bool bound) const override;
+    void toTuple(UTermVec &tuple, int &id) override;
+    PoolLiteral *clone() const override;
+    void print(std::ostream &out) const override;
+    bool operator==(Literal const &other) const override;
+    size_t hash() const override;
+    bool simplify(Logger &log, Projections &project, SimplifyState &state, bool positional = true, bool singleton = false) override;
+    void rewriteArithmetics(Term::ArithmeticsMap &arith, AssignVec &assign, AuxGen &auxGen) override;
+    ULitVec unpool(bool beforeRewrite) const override;
+    bool hasPool(bool beforeRewrite) const override;
+    void replace(Defines &dx) override;
+    Ground::ULit toGround(DomainData &x, bool auxiliary) const override;
+    ULit shift(bool negate) override;
+    UTerm headRepr() const override;
+    bool auxiliary() const override { return true; }
+    void auxiliary(bool) override { }
+    virtual ~PoolLiteral();
+    void getHeadSigs(std::function<void (Sig)>) const override { }
+
+    UTerm assign;
+    SymVec values;
+};
+
 // }}}
 // {{{ declaration of ScriptLiteral
 
@@ -155,7 +185,7 @@ struct ScriptLiteral : Literal {
     void auxiliary(bool) override { }
     virtual ~ScriptLiteral();
     static ULit make(SimplifyState::ScriptMap::value_type &script);
-    void getNeg(std::function<void (Sig)>) const override { }
+    void getHeadSigs(std::function<void (Sig)>) const override { }
 
     UTerm assign;
     String name;
@@ -184,7 +214,7 @@ struct FalseLiteral : Literal {
     UTerm headRepr() const override;
     bool auxiliary() const override { return true; }
     void auxiliary(bool) override { }
-    void getNeg(std::function<void (Sig)>) const override { }
+    void getHeadSigs(std::function<void (Sig)>) const override { }
     virtual ~FalseLiteral();
 };
 
@@ -214,7 +244,7 @@ struct CSPLiteral : Literal {
     UTerm headRepr() const override;
     bool auxiliary() const override { return auxiliary_; }
     void auxiliary(bool auxiliary) override { auxiliary_ = auxiliary; }
-    void getNeg(std::function<void (Sig)>) const override { }
+    void getHeadSigs(std::function<void (Sig)>) const override { }
     virtual ~CSPLiteral();
 
     Terms terms;
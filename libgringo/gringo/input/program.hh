@@ -62,18 +62,30 @@ public:
     void begin(Location const &loc, String name, IdVec &&params);
     void add(UStm &&stm);
     void add(TheoryDef &&def, Logger &log);
+    // Adds facts to the program part with the given name and no parameters.
+    // Unlike parsed facts, constant definitions are not applied to them.
+    void addFacts(String name, SymSpan facts);
+    // Sets the maximum number of threads used to rewrite and check
+    // statements (0 for one thread per core, defaults to 1).
+    void setThreads(unsigned threads);
     void rewrite(Defines &defs, Logger &log);
     void check(Logger &log);
     void print(std::ostream &out) const;
     Ground::Program toGround(DomainData &domains, Logger &log);
+    // Translates only the blocks selected by the given parameters.
+    // Signatures of atoms defined by previously translated blocks are
+    // remembered so that atoms defined there are not reported as undefined.
+    Ground::Program toGround(Ground::Parameters const &params, DomainData &domains, Logger &log);
     ~Program();
 
 private:
+    Ground::Program toGround(Ground::Parameters const *params, DomainData &domains, Logger &log);
     void rewriteDots();
     void rewriteArithmetics();
     void unpool();
 
     unsigned              auxNames_ = 0;
+    unsigned              threads_ = 1;
     Ground::LocSet        locs_;
     Ground::SigSet        sigs_;
     BlockMap              blocks_;
@@ -37,6 +37,9 @@ enum class StatementType { RULE, EXTERNAL, WEAKCONSTRAINT };
 struct Statement : Printable, Locatable {
     Statement(UHeadAggr &&head, UBodyAggrVec &&body, StatementType type);
     virtual UStmVec unpool(bool beforeRewrite);
+    //! Replaces pools of symbols in predicate literals by variables bound by pool literals.
+    //! This is only done if unpooling would create more statements than there are alternatives.
+    virtual void rewritePools(AuxGen &gen);
     virtual void assignLevels(VarTermBoundVec &bound);
     virtual bool simplify(Projections &project, Logger &log);
     virtual void rewrite();
@@ -48,7 +51,7 @@ struct Statement : Printable, Locatable {
     virtual void toGround(ToGroundArg &x, Ground::UStmVec &stms) const;
     virtual void add(ULit &&lit);
     virtual void initTheory(TheoryDefs &def, Logger &log);
-    virtual void getNeg(std::function<void (Sig)> f) const;
+    virtual void getHeadSigs(std::function<void (Sig)> f) const;
     virtual ~Statement();
 
     UHeadAggr     head;
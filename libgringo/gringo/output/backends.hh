@@ -26,12 +26,27 @@
 #define _GRINGO_OUTPUT_BACKENDS_HH
 
 #include <gringo/backend.hh>
+#include <gringo/utility.hh>
 #include <potassco/convert.h>
 #include <potassco/aspif.h>
 #include <potassco/smodels.h>
 #include <potassco/theory_data.h>
+#include <reify/program.hh>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+#if CLASP_HAS_THREADS
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
 
-namespace Gringo { namespace Output {
+namespace Gringo {
+
+namespace Input { class GroundTermParser; }
+
+namespace Output {
 
 class SmodelsFormatBackend : public Potassco::SmodelsConvert {
 public:
@@ -44,6 +59,171 @@ private:
 
 using IntermediateFormatBackend = Potassco::AspifOutput;
 
+class PipelinedBackend;
+
+#if CLASP_HAS_THREADS
+// Passes statements to another backend on a separate thread.
+//
+// Statements are encoded as sequences of words into chunks, which are handed
+// over to the worker thread once full. This way, building the program in the
+// backend overlaps with grounding. The remaining calls synchronize with the
+// worker thread first: initProgram, beginStep, and endStep delimit steps, and
+// the theory calls might access theory data shared with the grounder.
+// Exceptions thrown in the worker thread are rethrown at the next
+// synchronization point.
+class PipelinedBackend : public Backend {
+public:
+    PipelinedBackend(UBackend &&out, size_t chunkSize = 1 << 16);
+    PipelinedBackend(PipelinedBackend const &) = delete;
+    PipelinedBackend &operator=(PipelinedBackend const &) = delete;
+
+    void initProgram(bool incremental) override;
+    void beginStep() override;
+
+    void rule(Head_t ht, const AtomSpan& head, const LitSpan& body) override;
+    void rule(Head_t ht, const AtomSpan& head, Weight_t bound, const WeightLitSpan& body) override;
+    void minimize(Weight_t prio, const WeightLitSpan& lits) override;
+
+    void project(const AtomSpan& atoms) override;
+    void output(Symbol sym, Potassco::Atom_t atom) override;
+    void output(Symbol sym, Potassco::LitSpan const& condition) override;
+    void output(Symbol sym, int value, Potassco::LitSpan const& condition) override;
+    void external(Atom_t a, Value_t v) override;
+    void assume(const LitSpan& lits) override;
+    void heuristic(Atom_t a, Heuristic_t t, int bias, unsigned prio, const LitSpan& condition) override;
+    void acycEdge(int s, int t, const LitSpan& condition) override;
+
+    void theoryTerm(Id_t termId, int number) override;
+    void theoryTerm(Id_t termId, const StringSpan& name) override;
+    void theoryTerm(Id_t termId, int cId, const IdSpan& args) override;
+    void theoryElement(Id_t elementId, const IdSpan& terms, const LitSpan& cond) override;
+    void theoryAtom(Id_t atomOrZero, Id_t termId, const IdSpan& elements) override;
+    void theoryAtom(Id_t atomOrZero, Id_t termId, const IdSpan& elements, Id_t op, Id_t rhs) override;
+
+    void endStep() override;
+    // Blocks until the worker thread has passed all statements to the backend.
+    void sync();
+    ~PipelinedBackend() noexcept override;
+
+private:
+    enum class Op : uint32_t { Rule, WeightRule, Minimize, Project, OutputAtom, OutputTerm, OutputCSP, External, Assume, Heuristic, AcycEdge };
+    using Chunk = std::vector<uint32_t>;
+
+    void push(uint32_t word) { chunk_.emplace_back(word); }
+    void push(int word) { chunk_.emplace_back(static_cast<uint32_t>(word)); }
+    void push(Op op) { chunk_.emplace_back(static_cast<uint32_t>(op)); }
+    void push(Symbol sym);
+    template <class T>
+    void push(Potassco::Span<T> const &span);
+    void push(WeightLitSpan const &span);
+    void commit();
+    void flush();
+    void run();
+    void replay(Chunk const &chunk);
+
+    static constexpr size_t maxPending_ = 16;
+
+    UBackend out_;
+    size_t chunkSize_;
+    Chunk chunk_;
+    std::deque<Chunk> pending_;
+    std::vector<Chunk> free_;
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::condition_variable done_;
+    std::exception_ptr exception_;
+    bool busy_ = false;
+    bool stop_ = false;
+    // must be declared last because it is started in the constructor
+    std::thread thread_;
+};
+#endif
+
+// Collects the facts produced by a Reifier as symbols.
+//
+// This way, reified programs can be passed to another control without
+// printing and parsing them again. Terms in textual form, which stem from
+// output statements read from aspif, are parsed; backends that know the
+// symbol set it via setTerm() instead.
+class SymbolSink : public Reify::FactSink {
+public:
+    SymbolSink();
+    SymbolSink(SymbolSink const &) = delete;
+    SymbolSink &operator=(SymbolSink const &) = delete;
+
+    void beginFact(char const *name) override;
+    void beginFunction(char const *name) override;
+    void endFunction() override;
+    void number(int num) override;
+    void identifier(char const *name) override;
+    void string(StringSpan const &str) override;
+    void term(StringSpan const &str) override;
+    void endFact() override;
+
+    // Use the given symbol for the next term.
+    void setTerm(Symbol sym) { term_ = sym; }
+    SymVec &facts() { return facts_; }
+    ~SymbolSink() noexcept override;
+
+private:
+    String name(char const *name);
+    Symbol pop();
+
+    struct NameHash {
+        size_t operator()(char const *name) const { return strhash(name); }
+    };
+    struct NameEqual {
+        bool operator()(char const *a, char const *b) const { return std::strcmp(a, b) == 0; }
+    };
+
+    // names are looked up by content and keyed by the interned strings
+    std::unordered_map<char const *, String, NameHash, NameEqual> names_;
+    std::vector<std::pair<String, size_t>> stack_;
+    SymVec args_;
+    SymVec facts_;
+    Symbol term_;
+    std::unique_ptr<Input::GroundTermParser> parser_;
+};
+
+// Reifies the program into symbols.
+// The facts of a step are passed to the given callback when the step ends.
+class ReifyBackend : public Backend {
+public:
+    using FactCallback = std::function<void (SymSpan facts)>;
+
+    ReifyBackend(FactCallback cb, bool calculateSCCs, bool reifySteps);
+
+    void initProgram(bool incremental) override;
+    void beginStep() override;
+
+    void rule(Head_t ht, const AtomSpan& head, const LitSpan& body) override;
+    void rule(Head_t ht, const AtomSpan& head, Weight_t bound, const WeightLitSpan& body) override;
+    void minimize(Weight_t prio, const WeightLitSpan& lits) override;
+
+    void project(const AtomSpan& atoms) override;
+    void output(Symbol sym, Potassco::Atom_t atom) override;
+    void output(Symbol sym, Potassco::LitSpan const& condition) override;
+    void output(Symbol sym, int value, Potassco::LitSpan const& condition) override;
+    void external(Atom_t a, Value_t v) override;
+    void assume(const LitSpan& lits) override;
+    void heuristic(Atom_t a, Heuristic_t t, int bias, unsigned prio, const LitSpan& condition) override;
+    void acycEdge(int s, int t, const LitSpan& condition) override;
+
+    void theoryTerm(Id_t termId, int number) override;
+    void theoryTerm(Id_t termId, const StringSpan& name) override;
+    void theoryTerm(Id_t termId, int cId, const IdSpan& args) override;
+    void theoryElement(Id_t elementId, const IdSpan& terms, const LitSpan& cond) override;
+    void theoryAtom(Id_t atomOrZero, Id_t termId, const IdSpan& elements) override;
+    void theoryAtom(Id_t atomOrZero, Id_t termId, const IdSpan& elements, Id_t op, Id_t rhs) override;
+
+    void endStep() override;
+
+private:
+    SymbolSink sink_;
+    FactCallback cb_;
+    Reify::Reifier reifier_;
+};
+
 } } // namespace Output Gringo
 
 #endif // _GRINGO_OUTPUT_BACKENDS_HH
@@ -724,8 +724,10 @@ private:
 
 class PredicateDomain : public AbstractDomain<PredicateAtom> {
 public:
-    explicit PredicateDomain(Sig sig)
-    : sig_(sig) { }
+    explicit PredicateDomain(Sig sig, Id_t step = 0)
+    : sig_(sig)
+    , projection_(sig.name().startsWith("#p_"))
+    , stepOffsets_{{step, 0}} { }
 
     using AbstractDomain<PredicateAtom>::define;
     // Defines (adds) an atom setting its generation and fact status.
@@ -743,7 +745,7 @@ public:
         return incOffset_;
     }
 
-    void incNext() {
+    void incNext(Id_t step) {
         // It is necessary to hide undefined literals because they should not interfere
         // with future definitions of the same atom.
         // In fact, they could be completely removed from the domain.
@@ -753,6 +755,16 @@ public:
             if (!it->defined()) { hide(it); }
         }
         incOffset_ = size();
+        // steps that did not add atoms share their offset with the next step
+        if (stepOffsets_.back().second == incOffset_) { stepOffsets_.back().first = step; }
+        else                                         { stepOffsets_.emplace_back(step, incOffset_); }
+    }
+
+    // Returns the offset of the first atom added in the given grounding step
+    // or a later one.
+    SizeType stepOffset(Id_t step) const {
+        auto it = std::lower_bound(stepOffsets_.begin(), stepOffsets_.end(), step, [](std::pair<Id_t, SizeType> const &a, Id_t b) { return a.first < b; });
+        return it != stepOffsets_.end() ? it->second : size();
     }
 
     // This offset keeps track of atoms already added to the output table.
@@ -769,6 +781,8 @@ public:
         AbstractDomain<PredicateAtom>::clear();
         incOffset_  = 0;
         showOffset_ = 0;
+        stepOffsets_.erase(stepOffsets_.begin(), stepOffsets_.end() - 1);
+        stepOffsets_.back().second = 0;
     }
 
     Sig const &sig() const {
@@ -779,11 +793,22 @@ public:
         return sig_;
     }
 
-    std::pair<Id_t, Id_t> cleanup(AssignmentLookup assignment, Mapping &map);
+    // Projection domains hold the auxiliary atoms introduced to project
+    // anonymous variables from body literals.
+    bool isProjection() const {
+        return projection_;
+    }
+
+    // Removes false atoms and marks true atoms as facts.
+    // Additionally, all atoms added in grounding steps [forgetBegin, forgetEnd) are removed.
+    std::pair<Id_t, Id_t> cleanup(AssignmentLookup assignment, Mapping &map, Id_t forgetBegin = 0, Id_t forgetEnd = 0);
 private:
     Sig sig_;
+    bool projection_;
     SizeType incOffset_ = 0;
     SizeType showOffset_ = 0;
+    // Pairs of grounding steps and offsets of the first atoms added in them.
+    std::vector<std::pair<Id_t, SizeType>> stepOffsets_;
 };
 using UPredDom = std::unique_ptr<PredicateDomain>;
 
@@ -1076,6 +1101,7 @@ enum class TheoryTermType : int {
 };
 
 class DomainData {
+    using AtomLinkVec = std::vector<std::pair<Potassco::Atom_t, Potassco::Atom_t>>;
     using Tuples = UniqueVecVec<2, Symbol>;
     using Clauses = UniqueVecVec<2, LiteralId>;
     using Formulas = UniqueVecVec<2, std::pair<Id_t,Id_t>, value_hash<std::pair<Id_t,Id_t>>>;
@@ -1090,7 +1116,7 @@ public:
     PredicateDomain &add(Sig const &sig) {
         auto it(predDomains_.find(sig));
         if (it == predDomains_.end()) {
-            it = predDomains_.push(gringo_make_unique<PredicateDomain>(sig)).first;
+            it = predDomains_.push(gringo_make_unique<PredicateDomain>(sig, step_)).first;
             it->get()->setDomainOffset(predDomains_.offset(it));
         }
         return **it;
@@ -1126,6 +1152,18 @@ public:
         return getDom<D const>(lit.domain())[lit.offset()];
     }
     Potassco::Atom_t newAtom() { return ++atoms_; }
+    // The number of the current (or next) grounding step.
+    Id_t step() const { return step_; }
+    void nextStep() { ++step_; }
+    // Atoms with uids up to this bound have been passed to the backend in
+    // previous grounding steps; the bound is zero outside of grounding.
+    void markPreviousAtoms() { previousAtoms_ = atoms_; }
+    void clearPreviousAtoms() { previousAtoms_ = 0; }
+    bool isPreviousAtom(Potassco::Atom_t uid) const { return uid <= previousAtoms_; }
+    // Links a fresh uid to the uid an atom had in a previous step.
+    // The links are turned into rules by the backend output.
+    void linkAtom(Potassco::Atom_t newUid, Potassco::Atom_t oldUid) { atomLinks_.emplace_back(newUid, oldUid); }
+    AtomLinkVec &atomLinks() { return atomLinks_; }
     LiteralId newAux(NAF naf = NAF::POS) { return {naf, Gringo::Output::AtomType::Aux, newAtom(), 0}; }
     LiteralId newDelayed(NAF naf = NAF::POS) { return {naf, Gringo::Output::AtomType::Aux, newAtom(), 1}; }
     LiteralId getTrueLit() {
@@ -1217,6 +1255,9 @@ private:
     PredDomMap predDomains_;
     UDomVec domains_;
     Potassco::Atom_t atoms_ = 0;
+    Potassco::Atom_t previousAtoms_ = 0;
+    AtomLinkVec atomLinks_;
+    Id_t step_ = 0;
     Clauses clauses_;
     Tuples tuples_;
     Formulas formulas_;
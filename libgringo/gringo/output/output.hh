@@ -54,6 +54,8 @@ public:
     BackendOutput(UBackend &&out);
     void output(DomainData &data, Statement &stm) override;
 private:
+    void outputLinks(DomainData &data);
+
     UBackend out_;
 };
 
@@ -61,6 +63,7 @@ struct OutputOptions {
     OutputDebug debug      = OutputDebug::NONE;
     bool        reifySCCs  = false;
     bool        reifySteps = false;
+    bool        pipeline   = false;
 };
 
 using Assumptions = std::vector<std::pair<Gringo::Symbol, bool>>;
@@ -70,7 +73,9 @@ public:
     OutputBase(Potassco::TheoryData &data, OutputPredicates &&outPreds, UBackend &&out, OutputOptions opts = OutputOptions());
     OutputBase(Potassco::TheoryData &data, OutputPredicates &&outPreds, UAbstractOutput &&out);
 
-    std::pair<Id_t, Id_t> simplify(AssignmentLookup assignment);
+    // Removes false atoms from the domains and marks true atoms as facts.
+    // Atoms added in grounding steps [forgetBegin, forgetEnd) are removed, too.
+    std::pair<Id_t, Id_t> simplify(AssignmentLookup assignment, Id_t forgetBegin = 0, Id_t forgetEnd = 0);
     void incremental();
     void output(Statement &x);
     void flush();
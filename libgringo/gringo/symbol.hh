@@ -191,6 +191,9 @@ public:
 
     // ouput
     void print(std::ostream& out) const;
+    // appends the same text as print(std::ostream&) to the given string
+    // (avoids the overhead of streams when formatting many symbols)
+    void print(std::string& out) const;
 
     uint64_t const &rep () const { return rep_; }
 private:
@@ -204,8 +207,8 @@ inline std::ostream& operator<<(std::ostream& out, Symbol sym) {
 
 // {{{1 definition of quote/unquote
 
-inline std::string quote(StringSpan str) {
-    std::string res;
+// appends the quoted string to res
+inline void quote(std::string &res, StringSpan str) {
     for (auto c : str) {
         switch (c) {
             case '\n': {
@@ -229,6 +232,10 @@ inline std::string quote(StringSpan str) {
             }
         }
     }
+}
+inline std::string quote(StringSpan str) {
+    std::string res;
+    quote(res, str);
     return res;
 }
 inline std::string quote(char const *str) {
@@ -782,6 +782,39 @@ struct LinearTerm : Term {
     int n;
 };
 
+// }}}
+// }}}
+// {{{ declaration of FlatMatcher
+
+//! Matcher specialized for flat function terms p(t1,...,tn) with n <= 8
+//! whose arguments are constants or variables.
+//! Such terms are matched by comparing the signature and argument words of a
+//! symbol directly; all other terms are matched via Term::match.
+//! \note The binding flags of the variables are fixed upon construction and
+//! the matched term has to outlive the matcher.
+class FlatMatcher {
+public:
+    static constexpr uint32_t MaxArity = 8;
+    explicit FlatMatcher(Term const &term);
+    bool match(Symbol const &x) const { return match_(*this, x); }
+    bool flat() const;
+
+private:
+    enum class Arg : uint8_t { Val, Bind, Compare };
+    using MatchFun = bool (*)(FlatMatcher const &, Symbol const &);
+
+    template <uint32_t N>
+    static bool matchFlat(FlatMatcher const &m, Symbol const &x);
+    static bool matchTerm(FlatMatcher const &m, Symbol const &x);
+
+    Term const *term_;
+    MatchFun match_;
+    Sig sig_;
+    Arg args_[MaxArity];
+    Symbol vals_[MaxArity];
+    Symbol *refs_[MaxArity];
+};
+
 // }}}
 
 // {{{ definition of Term and auxiliary functions
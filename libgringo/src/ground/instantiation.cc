@@ -70,10 +70,31 @@ void Instantiator::finalize(DependVec &&depends) {
     binders.emplace_back(gringo_make_unique<SolutionBinder>(), std::move(depends));
 }
 void Instantiator::enqueue(Queue &queue) { queue.enqueue(*this); }
-void Instantiator::instantiate(Output::OutputBase &out, Logger &log) {
+void Instantiator::instantiate(Output::OutputBase &out, Logger &log, GroundProgress *progress) {
 #if DEBUG_INSTANTIATION > 0
     std::cerr << "  instantiate: " << *this << std::endl;
 #endif
+    unsigned batches = 0;
+    bool unbatched = false;
+    for (auto &x : binders) {
+        if (x.index->beginBatch()) { ++batches; }
+        else if (x.index->unbatchedCalls()) { unbatched = true; }
+    }
+    if (batches > 0) {
+        // Each dry run only collects arguments of batched script calls. The
+        // arguments of a call might depend on the results of another one, so
+        // there are at most as many dry runs as binders batching calls.
+        for (unsigned i = 0; !unbatched && i < batches; ++i) {
+            enumerate(out, log, progress, false);
+            bool pending = false;
+            for (auto &x : binders) { pending = x.index->flushBatch(log) || pending; }
+            if (!pending) { break; }
+        }
+        for (auto &x : binders) { x.index->endBatch(); }
+    }
+    enumerate(out, log, progress, true);
+}
+void Instantiator::enumerate(Output::OutputBase &out, Logger &log, GroundProgress *progress, bool report) {
     auto ie = binders.rend(), it = ie - 1, ib = binders.rbegin();
     it->match(log);
     do {
@@ -87,7 +108,14 @@ void Instantiator::instantiate(Output::OutputBase &out, Logger &log) {
             std::cerr << "    advanced to: " << *it << std::endl;
 #endif
         }
-        if (it == ib) { callback->report(out, log); }
+        // dry runs can be cancelled, too, but do not count as progress
+        if (it == ib) {
+            if (progress) {
+                progress->check();
+                if (report) { progress->report(); }
+            }
+            if (report) { callback->report(out, log); }
+        }
         for (auto &x : it->depends) { binders[x].backjumpable = false; }
         for (++it; it != ie && it->backjumpable; ++it) { }
 #if DEBUG_INSTANTIATION > 1
@@ -126,7 +154,8 @@ void Queue::process(Output::OutputBase &out, Logger &log) {
 #endif
                 queue.swap(current);
                 for (Instantiator &x : current) {
-                    x.instantiate(out, log);
+                    if (progress) { progress->check(); }
+                    x.instantiate(out, log, progress);
                     x.enqueued = false;
                 }
                 for (Instantiator &x : current) { x.callback->propagate(*this); }
@@ -162,7 +191,17 @@ void Queue::enqueue(Domain &x) {
     }
     x.enqueue();
 }
-Queue::~Queue() { }
+Queue::~Queue() {
+    // grounding might have been cancelled; instantiators and domains
+    // left in the queue are reset so that they can be enqueued again
+    for (Instantiator &x : current) { x.enqueued = false; }
+    for (auto &queue : queues) {
+        for (Instantiator &x : queue) { x.enqueued = false; }
+    }
+    for (Domain &x : domains) {
+        do { x.nextGeneration(); } while (x.dequeue());
+    }
+}
 
 // }}}
 
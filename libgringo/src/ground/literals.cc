@@ -106,6 +106,59 @@ struct RangeMatcher : Binder {
     bool                firstMatch = false;
 };
 
+// }}}
+// {{{ declaration of PoolBinder
+
+struct PoolBinder : Binder {
+    PoolBinder(UTerm &&assign, SymVec const &values)
+        : assign(std::move(assign))
+        , values(values) { }
+    IndexUpdater *getUpdater() override { return nullptr; }
+    void match(Logger &) override { current = values.begin(); }
+    bool next() override {
+        while (current != values.end()) {
+            if (assign->match(*current++)) { return true; }
+        }
+        return false;
+    }
+    void print(std::ostream &out) const override {
+        out << *assign << "=";
+        print_comma(out, values, ";");
+    }
+    virtual ~PoolBinder() { }
+
+    UTerm                  assign;
+    SymVec const          &values;
+    SymVec::const_iterator current;
+};
+
+// }}}
+// {{{ declaration of PoolMatcher
+
+struct PoolMatcher : Binder {
+    PoolMatcher(Term &assign, SymVec const &values)
+        : assign(assign)
+        , values(values) { }
+    IndexUpdater *getUpdater() override { return nullptr; }
+    void match(Logger &log) override {
+        bool undefined = false;
+        Symbol a{assign.eval(undefined, log)};
+        firstMatch = !undefined && std::find(values.begin(), values.end(), a) != values.end();
+    }
+    bool next() override {
+        bool m = firstMatch;
+        firstMatch = false;
+        return m;
+    }
+    void print(std::ostream &out) const override {
+        out << assign << "=";
+        print_comma(out, values, ";");
+    }
+    Term         &assign;
+    SymVec const &values;
+    bool          firstMatch = false;
+};
+
 // }}}
 
 // {{{ declaration of ScriptBinder
@@ -117,21 +170,46 @@ struct ScriptBinder : Binder {
         , shared(shared) { }
     IndexUpdater *getUpdater() override { return nullptr; }
     void match(Logger &log) override {
-        SymVec args;
+        args.clear();
         bool undefined = false;
         for (auto &x : std::get<1>(shared)) { args.emplace_back(x->eval(undefined, log)); }
-        if (!undefined) {
-            matches = context.call(assign->loc(), std::get<0>(shared), Potassco::toSpan(args), log);
+        if (undefined) {
+            matches.clear();
+            setMatches(matches);
+        }
+        else if (batched) {
+            auto it = results.find(args);
+            if (it != results.end()) { setMatches(it->second); }
+            else if (collecting) {
+                // the (empty) result is filled in when flushing
+                pending.emplace_back(args);
+                setMatches(results.emplace(args, SymVec{}).first->second);
+            }
+            else { call(log); }
         }
-        else { matches = {}; }
-        current = matches.begin();
+        else { call(log); }
     }
     bool next() override {
-        while (current != matches.end()) {
+        while (current != end) {
             if (assign->match(*current++)) { return true; }
         }
         return false;
     }
+    bool beginBatch() override {
+        batched = collecting = context.batchable(std::get<0>(shared));
+        results.clear();
+        pending.clear();
+        return batched;
+    }
+    bool flushBatch(Logger &log) override {
+        if (pending.empty()) { return false; }
+        auto ret = context.callBatch(assign->loc(), std::get<0>(shared), pending, log);
+        for (size_t i = 0; i < pending.size(); ++i) { results[pending[i]] = std::move(ret[i]); }
+        pending.clear();
+        return true;
+    }
+    void endBatch() override { collecting = false; }
+    bool unbatchedCalls() override { return !batched; }
     void print(std::ostream &out) const override {
         out << *assign << "=" << std::get<0>(shared) << "(";
         print_comma(out, std::get<1>(shared), ",", [](std::ostream &out, UTerm const &term) { out << *term; });
@@ -139,11 +217,28 @@ struct ScriptBinder : Binder {
     }
     virtual ~ScriptBinder() { }
 
-    Context             &context;
-    UTerm                assign;
-    ScriptLiteralShared &shared;
-    SymVec               matches;
-    SymVec::iterator     current;
+    void call(Logger &log) {
+        matches = context.call(assign->loc(), std::get<0>(shared), Potassco::toSpan(args), log);
+        setMatches(matches);
+    }
+    void setMatches(SymVec const &vals) {
+        current = vals.begin();
+        end = vals.end();
+    }
+
+    using Results = std::unordered_map<SymVec, SymVec, value_hash<SymVec>>;
+
+    Context               &context;
+    UTerm                  assign;
+    ScriptLiteralShared   &shared;
+    SymVec                 args;
+    SymVec                 matches;
+    Results                results;
+    std::vector<SymVec>    pending;
+    SymVec::const_iterator current;
+    SymVec::const_iterator end;
+    bool                   batched = false;
+    bool                   collecting = false;
 };
 
 // }}}
@@ -270,6 +365,10 @@ RangeLiteral::RangeLiteral(UTerm &&assign, UTerm &&lower, UTerm &&upper)
 : assign(std::move(assign))
 , range(std::move(lower), std::move(upper)) { }
 
+PoolLiteral::PoolLiteral(UTerm &&assign, SymVec &&values)
+: assign(std::move(assign))
+, values(std::move(values)) { }
+
 ScriptLiteral::ScriptLiteral(UTerm &&assign, String name, UTermVec &&args)
 : assign(std::move(assign))
 , shared(name, std::move(args)) { }
@@ -291,6 +390,10 @@ ProjectionLiteral::ProjectionLiteral(bool auxiliary, PredicateDomain &domain, UT
 // {{{ definition of *Literal::print
 
 void RangeLiteral::print(std::ostream &out) const     { out << *assign << "=" << *range.first << ".." << *range.second; }
+void PoolLiteral::print(std::ostream &out) const      {
+    out << *assign << "=";
+    print_comma(out, values, ";");
+}
 void ScriptLiteral::print(std::ostream &out) const    {
     out << *assign << "=" << std::get<0>(shared) << "(";
     print_comma(out, std::get<1>(shared), ",", [](std::ostream &out, UTerm const &term) { out << *term; });
@@ -312,6 +415,7 @@ void PredicateLiteral::print(std::ostream &out) const {
 // {{{ definition of *Literal::isRecursive
 
 bool RangeLiteral::isRecursive() const     { return false; }
+bool PoolLiteral::isRecursive() const      { return false; }
 bool ScriptLiteral::isRecursive() const    { return false; }
 bool RelationLiteral::isRecursive() const  { return false; }
 bool PredicateLiteral::isRecursive() const { return type == OccurrenceType::UNSTRATIFIED; }
@@ -320,6 +424,7 @@ bool PredicateLiteral::isRecursive() const { return type == OccurrenceType::UNST
 // {{{ definition of *Literal::occurrence
 
 BodyOcc *RangeLiteral::occurrence()     { return nullptr; }
+BodyOcc *PoolLiteral::occurrence()      { return nullptr; }
 BodyOcc *ScriptLiteral::occurrence()    { return nullptr; }
 BodyOcc *RelationLiteral::occurrence()  { return nullptr; }
 BodyOcc *PredicateLiteral::occurrence() { return this; }
@@ -332,6 +437,9 @@ void RangeLiteral::collect(VarTermBoundVec &vars) const {
     range.first->collect(vars, false);
     range.second->collect(vars, false);
 }
+void PoolLiteral::collect(VarTermBoundVec &vars) const {
+    assign->collect(vars, true);
+}
 void ScriptLiteral::collect(VarTermBoundVec &vars) const {
     assign->collect(vars, true);
     for (auto &x : std::get<1>(shared)) { x->collect(vars, false); }
@@ -354,6 +462,29 @@ void Literal::collectImportant(Term::VarSet &vars) {
     }
 }
 
+// }}}
+// {{{ definition of *Literal::collectBounds
+
+void Literal::collectBounds(Term::VarSet const &, VarBoundVec &) const { }
+
+void RelationLiteral::collectBounds(Term::VarSet const &bound, VarBoundVec &bounds) const {
+    auto add = [&](Term const &left, Relation rel, Term const &right) {
+        auto var = dynamic_cast<VarTerm const*>(&left);
+        if (!var || bound.find(var->name) != bound.end()) { return; }
+        VarTermBoundVec vars;
+        right.collect(vars, false);
+        for (auto &occ : vars) {
+            if (bound.find(occ.first->name) == bound.end()) { return; }
+        }
+        bounds.push_back({var->name, rel, right});
+    };
+    auto rel = std::get<0>(shared);
+    if (rel != Relation::EQ && rel != Relation::NEQ) {
+        add(*std::get<1>(shared), rel, *std::get<2>(shared));
+        add(*std::get<2>(shared), inv(rel), *std::get<1>(shared));
+    }
+}
+
 // }}}
 // {{{ definition of *Literal::index
 
@@ -361,6 +492,10 @@ UIdx RangeLiteral::index(Context &, BinderType, Term::VarSet &bound) {
     if (assign->bind(bound)) { return gringo_make_unique<RangeBinder>(get_clone(assign), range); }
     else                     { return gringo_make_unique<RangeMatcher>(*assign, range); }
 }
+UIdx PoolLiteral::index(Context &, BinderType, Term::VarSet &bound) {
+    if (assign->bind(bound)) { return gringo_make_unique<PoolBinder>(get_clone(assign), values); }
+    else                     { return gringo_make_unique<PoolMatcher>(*assign, values); }
+}
 UIdx ScriptLiteral::index(Context &context, BinderType, Term::VarSet &bound) {
     UTerm clone(assign->clone());
     clone->bind(bound);
@@ -377,6 +512,39 @@ UIdx RelationLiteral::index(Context &, BinderType, Term::VarSet &bound) {
 UIdx PredicateLiteral::index(Context &, BinderType type, Term::VarSet &bound) {
     return make_binder(domain, naf, *repr, offset, type, isRecursive(), bound, 0);
 }
+UIdx Literal::rangeIndex(Context &context, BinderType type, Term::VarSet &bound, VarBoundVec const &) {
+    return index(context, type, bound);
+}
+UIdx PredicateLiteral::rangeIndex(Context &context, BinderType type, Term::VarSet &bound, VarBoundVec const &bounds) {
+    // restrict the matches if all variables are unbound
+    // and an argument is a variable bounded by a comparison
+    // (atoms of the current generation are not sorted separately,
+    // so new atoms are better matched with a full index)
+    auto fun = dynamic_cast<FunctionTerm const*>(repr.get());
+    if (naf != NAF::POS || type == BinderType::NEW || bounds.empty() || !fun) { return index(context, type, bound); }
+    VarTermBoundVec vars;
+    repr->collect(vars, false);
+    for (auto &occ : vars) {
+        if (bound.find(occ.first->name) != bound.end()) { return index(context, type, bound); }
+    }
+    Id_t position = 0;
+    for (auto &arg : fun->args) {
+        if (auto var = dynamic_cast<VarTerm const*>(arg.get())) {
+            IndexBoundVec idxBounds;
+            for (auto &x : bounds) {
+                if (x.var == var->name) { idxBounds.emplace_back(x.rel, &x.term); }
+            }
+            if (!idxBounds.empty()) {
+                return make_sorted_binder(domain, *repr, offset, type, bound, position, std::move(idxBounds));
+            }
+        }
+        ++position;
+    }
+    return index(context, type, bound);
+}
+UIdx ProjectionLiteral::rangeIndex(Context &context, BinderType type, Term::VarSet &bound, VarBoundVec const &) {
+    return index(context, type, bound);
+}
 UIdx ProjectionLiteral::index(Context &, BinderType type, Term::VarSet &bound) {
     assert(bound.empty());
     assert(type == BinderType::ALL || type == BinderType::NEW);
@@ -386,14 +554,36 @@ UIdx ProjectionLiteral::index(Context &, BinderType type, Term::VarSet &bound) {
 // }}}
 // {{{ definition of *Literal::score
 
-Literal::Score RangeLiteral::score(Term::VarSet const &, Logger &log) {
+Literal::Score RangeLiteral::score(Term::VarSet const &bound, Logger &log) {
+    // if the assigned term is bound, the range is just a membership test
+    VarTermBoundVec vars;
+    assign->collect(vars, false);
+    bool filter = true;
+    for (auto &occ : vars) {
+        if (bound.find(occ.first->name) == bound.end()) {
+            filter = false;
+            break;
+        }
+    }
+    if (filter) { return -1; }
     if (range.first->getInvertibility() == Term::CONSTANT && range.second->getInvertibility() == Term::CONSTANT) {
         bool undefined = false;
         Symbol l(range.first->eval(undefined, log));
         Symbol r(range.second->eval(undefined, log));
         return (l.type() == SymbolType::Num && r.type() == SymbolType::Num) ? r.num() - l.num() : -1;
     }
-    return 0;
+    // the size of the range is not known in advance
+    // so it should only be enumerated if there is no other way to bind the variable
+    return std::numeric_limits<Literal::Score>::infinity();
+}
+Literal::Score PoolLiteral::score(Term::VarSet const &bound, Logger &) {
+    // like ranges, pools with a bound assigned term are membership tests
+    VarTermBoundVec vars;
+    assign->collect(vars, false);
+    for (auto &occ : vars) {
+        if (bound.find(occ.first->name) == bound.end()) { return static_cast<Score>(values.size()) - 1; }
+    }
+    return -1;
 }
 Literal::Score ScriptLiteral::score(Term::VarSet const &, Logger &) {
     return 0;
@@ -409,6 +599,7 @@ Literal::Score PredicateLiteral::score(Term::VarSet const &bound, Logger &) {
 // {{{ definition of *Literal::toOutput
 
 std::pair<Output::LiteralId,bool> RangeLiteral::toOutput(Logger &)     { return {Output::LiteralId(), true}; }
+std::pair<Output::LiteralId,bool> PoolLiteral::toOutput(Logger &)      { return {Output::LiteralId(), true}; }
 std::pair<Output::LiteralId,bool> ScriptLiteral::toOutput(Logger &)    { return {Output::LiteralId(), true}; }
 std::pair<Output::LiteralId,bool> RelationLiteral::toOutput(Logger &)  { return {Output::LiteralId(), true}; }
 std::pair<Output::LiteralId,bool> PredicateLiteral::toOutput(Logger &) {
@@ -433,6 +624,7 @@ std::pair<Output::LiteralId,bool> PredicateLiteral::toOutput(Logger &) {
 // {{{ definition of *Literal::~*Literal
 
 RangeLiteral::~RangeLiteral() { }
+PoolLiteral::~PoolLiteral() { }
 ScriptLiteral::~ScriptLiteral() { }
 RelationLiteral::~RelationLiteral() { }
 PredicateLiteral::~PredicateLiteral() { }
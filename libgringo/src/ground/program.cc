@@ -79,30 +79,16 @@ void Program::ground(Context &context, Output::OutputBase &out, Logger &log) {
     ground(params, context, out, true, log);
 }
 
-void Program::ground(Parameters const &params, Context &context, Output::OutputBase &out, bool finalize, Logger &log) {
+void Program::ground(Parameters const &params, Context &context, Output::OutputBase &out, bool finalize, Logger &log, GroundProgress *progress) {
+    // Projection atoms from previous steps are relinked lazily once they are
+    // used again (see Output::PredicateLiteral::uid).
+    out.data.markPreviousAtoms();
     for (auto &dom : out.predDoms()) {
-        auto name = dom->sig().name();
-        if (name.startsWith("#p_")) {
-            // The idea here is to assign a fresh uid to each projection atom.
-            // Furthermore, the fresh atom is derived by the old atom.
-            // This prevents redefinition errors from projections.
-            for (auto &atom : *dom) {
-                if (!atom.fact() && atom.hasUid() && atom.defined()) {
-                    Output::Rule &rule = out.tempRule(false);;
-                    Atom_t oldUid = atom.uid();
-                    Atom_t newUid = out.data.newAtom();
-                    rule.addHead(Output::LiteralId{NAF::POS, Output::AtomType::Aux, newUid, dom->domainOffset()});
-                    rule.addBody(Output::LiteralId{NAF::POS, Output::AtomType::Aux, oldUid, dom->domainOffset()});
-                    out.output(rule);
-                    atom.resetUid(newUid);
-                }
-            }
-        }
-        else if (name.startsWith("#inc_")) {
+        if (dom->sig().name().startsWith("#inc_")) {
             // clear incremental domains
             dom->clear();
         }
-        dom->incNext();
+        dom->incNext(out.data.step());
     }
     out.checkOutPreds(log);
     for (auto &x : edb) {
@@ -130,22 +116,30 @@ void Program::ground(Parameters const &params, Context &context, Output::OutputB
     }
     for (auto &x : out.predDoms()) { x->nextGeneration(); }
     Queue q;
-    for (auto &x : stms) {
-        if (!linearized) {
-            for (auto &y : x.first) { y->startLinearize(true); }
-            for (auto &y : x.first) { y->linearize(context, x.second, log); }
-            for (auto &y : x.first) { y->startLinearize(false); }
-        }
+    q.progress = progress;
+    bool cancelled = false;
+    try {
+        for (auto &x : stms) {
+            if (!linearized) {
+                for (auto &y : x.first) { y->startLinearize(true); }
+                for (auto &y : x.first) { y->linearize(context, x.second, log); }
+                for (auto &y : x.first) { y->startLinearize(false); }
+            }
 #if DEBUG_INSTANTIATION > 0
-        std::cerr << "============= component ===========" << std::endl;
+            std::cerr << "============= component ===========" << std::endl;
 #endif
-        for (auto &y : x.first) {
+            for (auto &y : x.first) {
 #if DEBUG_INSTANTIATION > 0
-            std::cerr << "  enqueue: " << *y << std::endl;
+                std::cerr << "  enqueue: " << *y << std::endl;
 #endif
-            y->enqueue(q);
+                y->enqueue(q);
+            }
+            q.process(out, log);
         }
-        q.process(out, log);
+    }
+    catch (GroundCancelled const &) {
+        // the step is finished with the rules grounded so far
+        cancelled = true;
     }
     for (auto &x : negate) {
         for (auto neg(x.second.begin() + x.second.incOffset()), ie(x.second.end()); neg != ie; ++neg) {
@@ -161,6 +155,8 @@ void Program::ground(Parameters const &params, Context &context, Output::OutputB
     }
     out.flush();
     if (finalize) { out.endStep(true, log); }
+    out.data.nextStep();
+    if (cancelled) { throw GroundCancelled(); }
     linearized = true;
 }
 
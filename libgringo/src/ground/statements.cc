@@ -147,7 +147,10 @@ InstVec _linearize(Logger &log, Context &context, bool positive, SolutionCallbac
                 }
                 else { y->data.depends.insert(y->data.depends.end(), bb.second.begin(), bb.second.end()); }
             }
-            auto index(y->data.lit.index(context, y->data.type, bound));
+            // comparisons with bound terms can restrict the atoms a predicate literal has to consider
+            VarBoundVec bounds;
+            for (auto &lit : x) { lit.second->collectBounds(bound, bounds); }
+            auto index(y->data.lit.rangeIndex(context, y->data.type, bound, bounds));
             if (auto update = index->getUpdater()) {
                 if (BodyOcc *occ = y->data.lit.occurrence()) {
                     for (HeadOccurrence &x : occ->definedBy()) { x.defines(*update, y->data.type == BinderType::NEW ? &insts.back() : nullptr); }
@@ -1088,8 +1088,8 @@ CreateHead TupleHeadAggregate::toGround(ToGroundArg &x, Ground::UStmVec &stms, G
     }
 }
 
-void TupleHeadAggregate::getNeg(std::function<void (Sig)> f) const {
-    for (auto &x : elems) { std::get<1>(x)->getNeg(f); }
+void TupleHeadAggregate::getHeadSigs(std::function<void (Sig)> f) const {
+    for (auto &x : elems) { std::get<1>(x)->getHeadSigs(f); }
 }
 
 // {{{1 definition of LitHeadAggregate
@@ -1233,8 +1233,8 @@ void LitHeadAggregate::replace(Defines &x) {
     }
 }
 
-void LitHeadAggregate::getNeg(std::function<void (Sig)> f) const {
-    for (auto &x : elems) { x.first->getNeg(f); }
+void LitHeadAggregate::getHeadSigs(std::function<void (Sig)> f) const {
+    for (auto &x : elems) { x.first->getHeadSigs(f); }
 }
 
 CreateHead LitHeadAggregate::toGround(ToGroundArg &, Ground::UStmVec &, Ground::RuleType) const {
@@ -1462,9 +1462,9 @@ void Disjunction::replace(Defines &x) {
     }
 }
 
-void Disjunction::getNeg(std::function<void (Sig)> f) const {
+void Disjunction::getHeadSigs(std::function<void (Sig)> f) const {
     for (auto &x : elems) {
-        for (auto &y : x.first) { y.first->getNeg(f); }
+        for (auto &y : x.first) { y.first->getHeadSigs(f); }
     }
 }
 
@@ -1603,8 +1603,8 @@ void SimpleHeadLiteral::replace(Defines &x) {
     lit->replace(x);
 }
 
-void SimpleHeadLiteral::getNeg(std::function<void (Sig)> f) const {
-    lit->getNeg(f);
+void SimpleHeadLiteral::getHeadSigs(std::function<void (Sig)> f) const {
+    lit->getHeadSigs(f);
 }
 
 CreateHead SimpleHeadLiteral::toGround(ToGroundArg &x, Ground::UStmVec &, Ground::RuleType type) const {
@@ -1921,7 +1921,7 @@ Term &MinimizeHeadLiteral::priority() const {
     return *tuple_[1];
 }
 
-void MinimizeHeadLiteral::getNeg(std::function<void (Sig)>) const { }
+void MinimizeHeadLiteral::getHeadSigs(std::function<void (Sig)>) const { }
 
 // {{{1 definition of EdgeHeadAtom
 
@@ -2008,7 +2008,7 @@ CreateHead EdgeHeadAtom::toGround(ToGroundArg &, Ground::UStmVec &, Ground::Rule
     });
 }
 
-void EdgeHeadAtom::getNeg(std::function<void (Sig)>) const { }
+void EdgeHeadAtom::getHeadSigs(std::function<void (Sig)>) const { }
 
 // {{{1 definition of ProjectHeadAtom
 
@@ -2090,7 +2090,7 @@ CreateHead ProjectHeadAtom::toGround(ToGroundArg &, Ground::UStmVec &, Ground::R
     });
 }
 
-void ProjectHeadAtom::getNeg(std::function<void (Sig)>) const { }
+void ProjectHeadAtom::getHeadSigs(std::function<void (Sig)>) const { }
 
 // {{{1 definition of HeuristicHeadAtom
 
@@ -2195,7 +2195,7 @@ CreateHead HeuristicHeadAtom::toGround(ToGroundArg &, Ground::UStmVec &, Ground:
     });
 }
 
-void HeuristicHeadAtom::getNeg(std::function<void (Sig)>) const { }
+void HeuristicHeadAtom::getHeadSigs(std::function<void (Sig)>) const { }
 
 // {{{1 definition of ShowHeadLiteral
 
@@ -2274,7 +2274,7 @@ CreateHead ShowHeadLiteral::toGround(ToGroundArg &, Ground::UStmVec &, Ground::R
     });
 }
 
-void ShowHeadLiteral::getNeg(std::function<void (Sig)>) const { }
+void ShowHeadLiteral::getHeadSigs(std::function<void (Sig)>) const { }
 
 // }}}1
 
@@ -47,6 +47,11 @@ inline void PredicateLiteral::print(std::ostream &out) const {
 }
 inline void RelationLiteral::print(std::ostream &out) const  { out << *left << rel << *right; }
 inline void RangeLiteral::print(std::ostream &out) const     { out << "#range(" << *assign << "," << *lower << "," << *upper << ")"; }
+inline void PoolLiteral::print(std::ostream &out) const      {
+    out << "#pool(" << *assign << ",";
+    print_comma(out, values, ";");
+    out << ")";
+}
 inline void FalseLiteral::print(std::ostream &out) const     { out << "#false"; }
 inline void ScriptLiteral::print(std::ostream &out) const    {
     out << "#script(" << *assign << "," << name << "(";
@@ -75,6 +80,9 @@ RelationLiteral *RelationLiteral::clone() const {
 RangeLiteral *RangeLiteral::clone() const {
     return make_locatable<RangeLiteral>(loc(), get_clone(assign), get_clone(lower), get_clone(upper)).release();
 }
+PoolLiteral *PoolLiteral::clone() const {
+    return make_locatable<PoolLiteral>(loc(), get_clone(assign), SymVec(values)).release();
+}
 FalseLiteral *FalseLiteral::clone() const {
     return make_locatable<FalseLiteral>(loc()).release();
 }
@@ -108,6 +116,7 @@ bool RelationLiteral::simplify(Logger &log, Projections &, SimplifyState &state,
 bool RangeLiteral::simplify(Logger &, Projections &, SimplifyState &, bool, bool) {
     throw std::logic_error("RangeLiteral::simplify should never be called  if used properly");
 }
+bool PoolLiteral::simplify(Logger &, Projections &, SimplifyState &, bool, bool) { return true; }
 bool FalseLiteral::simplify(Logger &, Projections &, SimplifyState &, bool, bool) { return true; }
 bool ScriptLiteral::simplify(Logger &, Projections &, SimplifyState &, bool, bool) {
     throw std::logic_error("ScriptLiteral::simplify should never be called  if used properly");
@@ -133,6 +142,9 @@ void RangeLiteral::collect(VarTermBoundVec &vars, bool bound) const {
     lower->collect(vars, false);
     upper->collect(vars, false);
 }
+void PoolLiteral::collect(VarTermBoundVec &vars, bool bound) const {
+    assign->collect(vars, bound);
+}
 void FalseLiteral::collect(VarTermBoundVec &, bool) const { }
 void ScriptLiteral::collect(VarTermBoundVec &vars, bool bound) const {
     assign->collect(vars, bound);
@@ -156,6 +168,10 @@ inline bool RangeLiteral::operator==(Literal const &x) const {
     auto t = dynamic_cast<RangeLiteral const *>(&x);
     return t && is_value_equal_to(assign, t->assign) && is_value_equal_to(lower, t->lower) && is_value_equal_to(upper, t->upper);
 }
+inline bool PoolLiteral::operator==(Literal const &x) const {
+    auto t = dynamic_cast<PoolLiteral const *>(&x);
+    return t && is_value_equal_to(assign, t->assign) && values == t->values;
+}
 inline bool FalseLiteral::operator==(Literal const &x) const {
     return dynamic_cast<FalseLiteral const *>(&x) != nullptr;
 }
@@ -185,6 +201,7 @@ void RelationLiteral::rewriteArithmetics(Term::ArithmeticsMap &arith, AssignVec
 void RangeLiteral::rewriteArithmetics(Term::ArithmeticsMap &arith, AssignVec &, AuxGen &auxGen) {
     Term::replace(this->assign, this->assign->rewriteArithmetics(arith, auxGen));
 }
+void PoolLiteral::rewriteArithmetics(Term::ArithmeticsMap &, AssignVec &, AuxGen &) { }
 void FalseLiteral::rewriteArithmetics(Term::ArithmeticsMap &, AssignVec &, AuxGen &) { }
 void ScriptLiteral::rewriteArithmetics(Term::ArithmeticsMap &arith, AssignVec &, AuxGen &auxGen) {
     Term::replace(this->assign, this->assign->rewriteArithmetics(arith, auxGen));
@@ -204,6 +221,9 @@ inline size_t RelationLiteral::hash() const {
 inline size_t RangeLiteral::hash() const {
     return get_value_hash(typeid(RangeLiteral).hash_code(), assign, lower, upper);
 }
+inline size_t PoolLiteral::hash() const {
+    return get_value_hash(typeid(PoolLiteral).hash_code(), assign, values);
+}
 inline size_t FalseLiteral::hash() const {
     return get_value_hash(typeid(FalseLiteral).hash_code());
 }
@@ -236,6 +256,11 @@ ULitVec RangeLiteral::unpool(bool) const {
     value.emplace_back(ULit(clone()));
     return value;
 }
+ULitVec PoolLiteral::unpool(bool) const {
+    ULitVec value;
+    value.emplace_back(ULit(clone()));
+    return value;
+}
 ULitVec FalseLiteral::unpool(bool) const {
     ULitVec value;
     value.emplace_back(ULit(clone()));
@@ -281,6 +306,9 @@ void RelationLiteral::toTuple(UTermVec &tuple, int &id) {
 void RangeLiteral::toTuple(UTermVec &, int &) {
     throw std::logic_error("RangeLiteral::toTuple should never be called  if used properly");
 }
+void PoolLiteral::toTuple(UTermVec &, int &) {
+    throw std::logic_error("PoolLiteral::toTuple should never be called  if used properly");
+}
 void FalseLiteral::toTuple(UTermVec &tuple, int &id) {
     tuple.emplace_back(make_locatable<ValTerm>(loc(), Symbol::createNum(id+3)));
     id++;
@@ -306,6 +334,7 @@ Symbol PredicateLiteral::isEDB() const { return naf == NAF::POS ? repr->isEDB()
 inline bool PredicateLiteral::hasPool(bool) const { return repr->hasPool(); }
 inline bool RelationLiteral::hasPool(bool) const  { return left->hasPool() || right->hasPool(); }
 inline bool RangeLiteral::hasPool(bool) const                   { return false; }
+inline bool PoolLiteral::hasPool(bool) const                    { return false; }
 inline bool FalseLiteral::hasPool(bool) const                   { return false; }
 inline bool ScriptLiteral::hasPool(bool) const                  { return false; }
 inline bool CSPLiteral::hasPool(bool beforeRewrite) const       {
@@ -330,6 +359,9 @@ inline void RangeLiteral::replace(Defines &x) {
     Term::replace(lower, lower->replace(x, true));
     Term::replace(upper, upper->replace(x, true));
 }
+inline void PoolLiteral::replace(Defines &x) {
+    Term::replace(assign, assign->replace(x, true));
+}
 inline void FalseLiteral::replace(Defines &) { }
 inline void ScriptLiteral::replace(Defines &x) {
     Term::replace(assign, assign->replace(x, true));
@@ -355,6 +387,9 @@ inline Ground::ULit RelationLiteral::toGround(DomainData &, bool) const {
 inline Ground::ULit RangeLiteral::toGround(DomainData &, bool) const {
     return gringo_make_unique<Ground::RangeLiteral>(get_clone(assign), get_clone(lower), get_clone(upper));
 }
+inline Ground::ULit PoolLiteral::toGround(DomainData &, bool) const {
+    return gringo_make_unique<Ground::PoolLiteral>(get_clone(assign), SymVec(values));
+}
 inline Ground::ULit FalseLiteral::toGround(DomainData &, bool) const {
     throw std::logic_error("FalseLiteral::toGround: must not happen");
 }
@@ -382,6 +417,7 @@ ULit RelationLiteral::shift(bool negate) {
     return make_locatable<RelationLiteral>(loc(), negate ? neg(rel) : rel, std::move(left), std::move(right));
 }
 ULit RangeLiteral::shift(bool)  { throw std::logic_error("RangeLiteral::shift should never be called  if used properly"); }
+ULit PoolLiteral::shift(bool)   { throw std::logic_error("PoolLiteral::shift should never be called  if used properly"); }
 ULit FalseLiteral::shift(bool)  { return nullptr; }
 ULit ScriptLiteral::shift(bool) { throw std::logic_error("ScriptLiteral::shift should never be called  if used properly"); }
 ULit CSPLiteral::shift(bool negate) {
@@ -404,6 +440,9 @@ UTerm RelationLiteral::headRepr() const {
 UTerm RangeLiteral::headRepr() const {
     throw std::logic_error("RangeLiteral::toTuple should never be called if used properly");
 }
+UTerm PoolLiteral::headRepr() const {
+    throw std::logic_error("PoolLiteral::headRepr should never be called if used properly");
+}
 UTerm FalseLiteral::headRepr() const {
     return nullptr;
 }
@@ -427,9 +466,8 @@ PredicateLiteral::PredicateLiteral(NAF naf, UTerm &&repr, bool auxiliary)
     }
 }
 
-void PredicateLiteral::getNeg(std::function<void (Sig)> f) const {
-    Sig sig(repr->getSig());
-    if (sig.sign()) { f(sig); }
+void PredicateLiteral::getHeadSigs(std::function<void (Sig)> f) const {
+    f(repr->getSig());
 }
 
 PredicateLiteral::~PredicateLiteral() { }
@@ -474,6 +512,14 @@ ULit RangeLiteral::make(SimplifyState::DotsMap::value_type &dot) {
 
 RangeLiteral::~RangeLiteral() { }
 
+// {{{1 definition of PoolLiteral
+
+PoolLiteral::PoolLiteral(UTerm &&assign, SymVec &&values)
+    : assign(std::move(assign))
+    , values(std::move(values)) { }
+
+PoolLiteral::~PoolLiteral() { }
+
 // {{{1 definition of FalseLiteral
 
 FalseLiteral::FalseLiteral() { }
@@ -31,9 +31,62 @@
 #include "gringo/logger.hh"
 #include "gringo/graph.hh"
 #include "gringo/safetycheck.hh"
+#if CLASP_HAS_THREADS
+#include <future>
+#include <thread>
+#endif
 
 namespace Gringo { namespace Input {
 
+namespace {
+
+// {{{ definition of forEachChunk
+
+// Statements are only processed in parallel if each thread gets at least this many.
+constexpr size_t minChunkSize = 512;
+
+// Returns the number of chunks [0, size) is split into by forEachChunk
+// using at most the given number of threads (0 for one per core).
+size_t numChunks(size_t size, unsigned threads) {
+#if CLASP_HAS_THREADS
+    if (threads == 0) { threads = std::max(1u, std::thread::hardware_concurrency()); }
+    return std::max<size_t>(1, std::min<size_t>(threads, size / minChunkSize));
+#else
+    static_cast<void>(size);
+    static_cast<void>(threads);
+    return 1;
+#endif
+}
+
+// Splits [0, size) into the given number of consecutive chunks
+// and calls f(chunk, begin, end) for each of them in parallel.
+// Exceptions thrown by f are rethrown after all chunks have been processed.
+template <class F>
+void forEachChunk(size_t size, size_t chunks, F const &f) {
+#if CLASP_HAS_THREADS
+    auto bound = [size, chunks](size_t chunk) { return size * chunk / chunks; };
+    std::vector<std::future<void>> futures;
+    for (size_t chunk = 1; chunk < chunks; ++chunk) {
+        futures.emplace_back(std::async(std::launch::async, f, chunk, bound(chunk), bound(chunk + 1)));
+    }
+    std::exception_ptr exc;
+    try { f(0, bound(0), bound(1)); }
+    catch (...) { exc = std::current_exception(); }
+    for (auto &future : futures) {
+        try { future.get(); }
+        catch (...) { if (!exc) { exc = std::current_exception(); } }
+    }
+    if (exc) { std::rethrow_exception(exc); }
+#else
+    static_cast<void>(chunks);
+    f(0, 0, size);
+#endif
+}
+
+// }}}
+
+} // namespace
+
 // {{{ definition of Block
 
 Block::Block(Location const &loc, String name, IdVec &&params)
@@ -77,6 +130,31 @@ void Program::add(UStm &&stm) {
     }
 }
 
+void Program::addFacts(String name, SymSpan facts) {
+    // the program is only modified if all facts are valid
+    for (auto &fact : facts) {
+        if (fact.type() != SymbolType::Fun || fact.name().empty()) {
+            std::ostringstream oss;
+            oss << "cannot add fact: " << fact;
+            throw std::runtime_error(oss.str());
+        }
+    }
+    auto &block = *blocks_.push(Location("<facts>", 1, 1, "<facts>", 1, 1), (std::string("#inc_") + name.c_str()).c_str(), IdVec{}).first;
+    auto &edb = std::get<1>(*block.edb);
+    edb.reserve(edb.size() + facts.size);
+    sigs_.push(Sig(block.name, 0, false));
+    // facts are typically grouped by signature
+    Sig last(block.name, 0, false);
+    for (auto &fact : facts) {
+        edb.emplace_back(fact);
+        auto sig = fact.sig();
+        if (sig != last) {
+            sigs_.push(sig);
+            last = sig;
+        }
+    }
+}
+
 void Program::add(TheoryDef &&def, Logger &log) {
     auto it = theoryDefs_.find(def.name());
     if (it == theoryDefs_.end()) {
@@ -91,7 +169,12 @@ void Program::add(TheoryDef &&def, Logger &log) {
 
 }
 
+void Program::setThreads(unsigned threads) {
+    threads_ = threads;
+}
+
 void Program::rewrite(Defines &defs, Logger &log) {
+    std::vector<UStm*> rewritten;
     for (auto &block : blocks_) {
         // {{{3 replacing definitions
         Defines incDefs;
@@ -138,7 +221,6 @@ void Program::rewrite(Defines &defs, Logger &log) {
             std::get<1>(*block.edb).emplace_back(x->isEDB());
             if (std::get<1>(*block.edb).back().type() == SymbolType::Special) {
                 x->add(make_locatable<PredicateLiteral>(block.loc, NAF::POS, get_clone(blockTerm), true));
-                x->rewrite();
                 block.stms.emplace_back(std::move(x));
                 std::get<1>(*block.edb).pop_back();
             }
@@ -151,16 +233,32 @@ void Program::rewrite(Defines &defs, Logger &log) {
                 else                   { rewrite2(x); }
             }
         };
+        size_t offset = block.stms.size();
         for (auto &x : block.addedStms) {
             x->replace(defs);
             x->replace(incDefs);
+            x->rewritePools(gen);
             x->assignLevels(blockBound);
             if (x->hasPool(true)) { for (auto &y : x->unpool(true)) { rewrite1(y); } }
             else                  { rewrite1(x); }
         }
         block.addedStms.clear();
+        for (auto it = block.stms.begin() + offset, ie = block.stms.end(); it != ie; ++it) { rewritten.emplace_back(&*it); }
         // }}}3
     }
+    // {{{3 rewriting statements
+    // statements are rewritten independently of each other
+    // (auxiliary variables are numbered per statement);
+    // the statements of all blocks are processed by one set of threads
+    forEachChunk(rewritten.size(), numChunks(rewritten.size(), threads_), [&rewritten](size_t, size_t begin, size_t end) {
+        for (auto it = rewritten.begin() + begin, ie = rewritten.begin() + end; it != ie; ++it) { (**it)->rewrite(); }
+    });
+    // atoms in rule heads count as defined even if their block is not
+    // grounded in a step; the check in toGround relies on this
+    for (auto &x : rewritten) {
+        (*x)->getHeadSigs([this](Sig sig) { sigs_.push(sig); });
+    }
+    // }}}3
     // {{{3 projection
     for (auto &x : project_) {
         if (!x.done) {
@@ -178,8 +276,23 @@ void Program::rewrite(Defines &defs, Logger &log) {
 }
 
 void Program::check(Logger &log) {
+    std::vector<Statement const *> stms;
     for (auto &block : blocks_) {
-        for (auto &stm : block.stms) { stm->check(log); }
+        for (auto &stm : block.stms) { stms.emplace_back(stm.get()); }
+    }
+    // statements are checked in parallel; the messages of each chunk are
+    // buffered and passed on in the order of the statements afterwards
+    using Messages = std::vector<std::pair<Warnings, std::string>>;
+    std::vector<Messages> messages(numChunks(stms.size(), threads_));
+    forEachChunk(stms.size(), messages.size(), [&stms, &messages](size_t chunk, size_t begin, size_t end) {
+        auto &buffer = messages[chunk];
+        Logger chunkLog([&buffer](Warnings code, char const *msg) { buffer.emplace_back(code, msg); }, std::numeric_limits<unsigned>::max());
+        for (auto it = stms.begin() + begin, ie = stms.begin() + end; it != ie; ++it) { (*it)->check(chunkLog); }
+    });
+    for (auto &buffer : messages) {
+        for (auto &msg : buffer) {
+            if (log.check(msg.first)) { log.print(msg.first, msg.second.c_str()); }
+        }
     }
     std::unordered_map<Sig, Location> seenSigs;
     for (auto &def : theoryDefs_) {
@@ -209,10 +322,18 @@ void Program::print(std::ostream &out) const {
 }
 
 Ground::Program Program::toGround(DomainData &domains, Logger &log) {
+    return toGround(nullptr, domains, log);
+}
+
+Ground::Program Program::toGround(Ground::Parameters const &params, DomainData &domains, Logger &log) {
+    return toGround(&params, domains, log);
+}
+
+Ground::Program Program::toGround(Ground::Parameters const *params, DomainData &domains, Logger &log) {
     HashSet<uint64_t> neg;
     Ground::Program::ClassicalNegationVec negate;
     auto gn = [&neg, &negate, &domains](Sig x) {
-        if (neg.insert(std::hash<uint64_t>(), std::equal_to<uint64_t>(), x.rep()).second) {
+        if (x.sign() && neg.insert(std::hash<uint64_t>(), std::equal_to<uint64_t>(), x.rep()).second) {
             negate.emplace_back(domains.add(x.flipSign()), domains.add(x));
         }
     };
@@ -221,18 +342,21 @@ Ground::Program Program::toGround(DomainData &domains, Logger &log) {
     ToGroundArg arg(auxNames_, domains);
     Ground::SEdbVec edb;
     for (auto &block : blocks_) {
+        // rules of blocks that are not grounded cannot fire because their
+        // incremental domains are empty; they are left out of the analysis
+        if (params && !params->find(block.sig().getSig())) { continue; }
         for (auto &x : block.edb->second) {
             auto sig = x.sig();
             if (sig.sign()) { gn(sig); }
         }
         edb.emplace_back(block.edb);
         for (auto &x : block.stms) {
-            x->getNeg(gn);
+            x->getHeadSigs(gn);
             x->toGround(arg, stms);
         }
     }
     for (auto &x : stms_) {
-        x->getNeg(gn);
+        x->getHeadSigs(gn);
         x->toGround(arg, stms);
     }
     Ground::Statement::Dep dep;
@@ -35,6 +35,26 @@
 
 namespace Gringo { namespace Input {
 
+namespace {
+
+// Returns the values of the given terms if all of them are value terms.
+// Ground function terms are folded into symbols at construction time;
+// symbols are hash-consed, so that copies made by unpooling, rewriting,
+// and instantiating blocks share them instead of cloning term trees.
+// Only ground subterms are shared this way; terms with variables are still
+// owned by their parents and cloned because the rewriting passes modify
+// them in place.
+bool toSymbols(UTermVec const &args, SymVec &vals) {
+    for (auto &arg : args) {
+        auto val = dynamic_cast<ValTerm const*>(arg.get());
+        if (!val) { return false; }
+        vals.emplace_back(val->value);
+    }
+    return true;
+}
+
+} // namespace
+
 // {{{1 definition of NongroundProgramBuilder
 
 NongroundProgramBuilder::NongroundProgramBuilder(Context &context, Program &prg, Output::OutputBase &out, Defines &defs, bool rewriteMinimize)
@@ -89,8 +109,11 @@ TermUid NongroundProgramBuilder::term(Location const &loc, String name, TermVecV
         if (lua) { return make_locatable<LuaTerm>(loc, name, std::move(vec)); }
         // constant symbols
         else if (vec.empty()) { return make_locatable<ValTerm>(loc, Symbol::createId(name)); }
+        // ground function terms
+        SymVec vals;
+        if (toSymbols(vec, vals)) { return make_locatable<ValTerm>(loc, Symbol::createFun(name, Potassco::toSpan(vals))); }
         // function terms
-        else { return make_locatable<FunctionTerm>(loc, name, std::move(vec)); }
+        return make_locatable<FunctionTerm>(loc, name, std::move(vec));
     };
     TermVecVecs::ValueType vec(termvecvecs_.erase(a));
     // no pooling
@@ -105,8 +128,10 @@ TermUid NongroundProgramBuilder::term(Location const &loc, String name, TermVecV
 
 TermUid NongroundProgramBuilder::term(Location const &loc, TermVecUid args, bool forceTuple) {
     UTermVec a(termvecs_.erase(args));
-    UTerm ret(!forceTuple && a.size() == 1 ? std::move(a.front()) : make_locatable<FunctionTerm>(loc, "", std::move(a)));
-    return terms_.insert(std::move(ret));
+    if (!forceTuple && a.size() == 1) { return terms_.insert(std::move(a.front())); }
+    SymVec vals;
+    if (toSymbols(a, vals)) { return terms_.insert(make_locatable<ValTerm>(loc, Symbol::createTuple(Potassco::toSpan(vals)))); }
+    return terms_.insert(make_locatable<FunctionTerm>(loc, "", std::move(a)));
 }
 
 TermUid NongroundProgramBuilder::pool(Location const &loc, TermVecUid args) {
@@ -48,8 +48,8 @@ void Statement::initTheory(TheoryDefs &def, Logger &log) {
         lit->initTheory(def, log);
     }
 }
-void Statement::getNeg(std::function<void (Sig)> f) const {
-    head->getNeg(f);
+void Statement::getHeadSigs(std::function<void (Sig)> f) const {
+    head->getHeadSigs(f);
 }
 
 // {{{ definition of Statement::add
@@ -116,6 +116,88 @@ UStmVec Statement::unpool(bool beforeRewrite) {
     return x;
 }
 
+// }}}
+// {{{ definition of Statement::rewritePools
+
+void Statement::rewritePools(AuxGen &gen) {
+    if (type != StatementType::RULE) { return; }
+    // the representations of the predicate literals in simple heads and bodies
+    std::vector<UTerm*> reprs;
+    auto addRepr = [&reprs](ULit &lit) {
+        if (auto pred = dynamic_cast<PredicateLiteral*>(lit.get())) { reprs.emplace_back(&pred->repr); }
+    };
+    if (auto lit = dynamic_cast<SimpleHeadLiteral*>(head.get())) { addRepr(lit->lit); }
+    for (auto &x : body) {
+        if (auto lit = dynamic_cast<SimpleBodyLiteral*>(x.get())) { addRepr(lit->lit); }
+    }
+    // collect pools whose alternatives are all symbols
+    // (the flag indicates that the whole atom is pooled)
+    auto symbols = [](Term const &pool, SymVec &values) {
+        UTermVec alts;
+        pool.unpool(alts);
+        for (auto &alt : alts) {
+            values.emplace_back(alt->isEDB());
+            if (values.back().type() == SymbolType::Special) { return false; }
+        }
+        return true;
+    };
+    std::vector<std::tuple<UTerm*, SymVec, bool>> pools;
+    for (auto &repr : reprs) {
+        SymVec values;
+        if (dynamic_cast<PoolTerm*>(repr->get())) {
+            if (!symbols(**repr, values)) { continue; }
+            Sig sig = values.front().type() == SymbolType::Fun ? values.front().sig() : Sig("", 0, false);
+            bool atoms = sig.arity() > 0 && !sig.sign() && std::all_of(values.begin(), values.end(), [sig](Symbol const &val) {
+                return val.type() == SymbolType::Fun && val.sig() == sig;
+            });
+            if (atoms) { pools.emplace_back(repr, std::move(values), true); }
+        }
+        else if (auto fun = dynamic_cast<FunctionTerm*>(repr->get())) {
+            for (auto &arg : fun->args) {
+                values.clear();
+                if (dynamic_cast<PoolTerm*>(arg.get()) && symbols(*arg, values)) {
+                    pools.emplace_back(&arg, std::move(values), false);
+                }
+            }
+        }
+    }
+    // unpooling creates as many statements as the product of the pool sizes
+    double product = 1, sum = 0;
+    for (auto &pool : pools) {
+        product *= std::get<1>(pool).size();
+        sum += std::get<1>(pool).size();
+    }
+    if (product <= sum) { return; }
+    for (auto &pool : pools) {
+        auto &term = *std::get<0>(pool);
+        auto &values = std::get<1>(pool);
+        Location loc(term->loc());
+        UTerm assign;
+        if (std::get<2>(pool)) {
+            Sig sig = values.front().sig();
+            UTermVec args, vars;
+            for (uint32_t i = 0; i < sig.arity(); ++i) {
+                args.emplace_back(gen.uniqueVar(loc, 0, "#Pool"));
+                vars.emplace_back(get_clone(args.back()));
+            }
+            term = make_locatable<FunctionTerm>(loc, sig.name(), std::move(args));
+            if (sig.arity() == 1) {
+                assign = std::move(vars.front());
+                for (auto &val : values) { val = *val.args().first; }
+            }
+            else {
+                assign = make_locatable<FunctionTerm>(loc, String(""), std::move(vars));
+                for (auto &val : values) { val = Symbol::createTuple(val.args()); }
+            }
+        }
+        else {
+            assign = gen.uniqueVar(loc, 0, "#Pool");
+            term = get_clone(assign);
+        }
+        add(make_locatable<PoolLiteral>(loc, std::move(assign), std::move(values)));
+    }
+}
+
 // }}}
 // {{{ definition of Statement::hasPool
 
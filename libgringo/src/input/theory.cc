@@ -491,7 +491,7 @@ void HeadTheoryLiteral::initTheory(TheoryDefs &defs, bool hasBody, Logger &log)
     atom_.initTheory(loc(), defs, false, hasBody, log);
 }
 
-void HeadTheoryLiteral::getNeg(std::function<void (Sig)>) const { }
+void HeadTheoryLiteral::getHeadSigs(std::function<void (Sig)>) const { }
 
 // {{{1 definition of BodyTheoryLiteral
 
@@ -0,0 +1,515 @@
+// {{{ MIT License
+
+// Copyright 2017 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#include "gringo/output/backends.hh"
+#include "gringo/input/groundtermparser.hh"
+#include "gringo/logger.hh"
+
+namespace Gringo { namespace Output {
+
+// {{{1 definition of PipelinedBackend
+
+#if CLASP_HAS_THREADS
+PipelinedBackend::PipelinedBackend(UBackend &&out, size_t chunkSize)
+: out_(std::move(out))
+, chunkSize_(chunkSize)
+, thread_([this]() { run(); }) {
+    chunk_.reserve(chunkSize_);
+}
+
+void PipelinedBackend::push(Symbol sym) {
+    uint64_t rep = sym.rep();
+    push(static_cast<uint32_t>(rep));
+    push(static_cast<uint32_t>(rep >> 32));
+}
+
+template <class T>
+void PipelinedBackend::push(Potassco::Span<T> const &span) {
+    push(static_cast<uint32_t>(span.size));
+    for (auto &x : span) { push(static_cast<uint32_t>(x)); }
+}
+
+void PipelinedBackend::push(WeightLitSpan const &span) {
+    push(static_cast<uint32_t>(span.size));
+    for (auto &x : span) {
+        push(x.lit);
+        push(x.weight);
+    }
+}
+
+void PipelinedBackend::commit() {
+    if (chunk_.size() >= chunkSize_) { flush(); }
+}
+
+void PipelinedBackend::flush() {
+    if (chunk_.empty()) { return; }
+    std::unique_lock<std::mutex> lock(mutex_);
+    // bound the memory used by chunks if the backend cannot keep up
+    done_.wait(lock, [this]() { return pending_.size() < maxPending_; });
+    pending_.emplace_back(std::move(chunk_));
+    if (!free_.empty()) {
+        chunk_ = std::move(free_.back());
+        free_.pop_back();
+    }
+    else {
+        chunk_ = Chunk();
+        chunk_.reserve(chunkSize_);
+    }
+    lock.unlock();
+    ready_.notify_one();
+}
+
+void PipelinedBackend::sync() {
+    flush();
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return pending_.empty() && !busy_; });
+    if (exception_) {
+        auto exception = exception_;
+        exception_ = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+void PipelinedBackend::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        ready_.wait(lock, [this]() { return stop_ || !pending_.empty(); });
+        if (pending_.empty()) { break; }
+        Chunk chunk = std::move(pending_.front());
+        pending_.pop_front();
+        busy_ = true;
+        // after an error, chunks are dropped until the error has been reported
+        bool failed = static_cast<bool>(exception_);
+        lock.unlock();
+        std::exception_ptr exception;
+        if (!failed) {
+            try         { replay(chunk); }
+            catch (...) { exception = std::current_exception(); }
+        }
+        chunk.clear();
+        lock.lock();
+        if (exception) { exception_ = exception; }
+        free_.emplace_back(std::move(chunk));
+        busy_ = false;
+        done_.notify_all();
+    }
+}
+
+void PipelinedBackend::replay(Chunk const &chunk) {
+    BackendAtomVec atoms;
+    BackendLitVec lits;
+    BackendLitWeightVec wlits;
+    auto it = chunk.begin();
+    auto word = [&it]() { return *it++; };
+    auto num = [&it]() { return static_cast<int>(*it++); };
+    auto sym = [&it]() {
+        uint64_t lo = *it++;
+        uint64_t hi = *it++;
+        return Symbol(lo | hi << 32);
+    };
+    auto atomSpan = [&]() -> AtomSpan {
+        atoms.clear();
+        for (uint32_t n = word(); n > 0; --n) { atoms.emplace_back(word()); }
+        return Potassco::toSpan(atoms);
+    };
+    auto litSpan = [&]() -> LitSpan {
+        lits.clear();
+        for (uint32_t n = word(); n > 0; --n) { lits.emplace_back(num()); }
+        return Potassco::toSpan(lits);
+    };
+    auto wlitSpan = [&]() -> WeightLitSpan {
+        wlits.clear();
+        for (uint32_t n = word(); n > 0; --n) {
+            Potassco::Lit_t lit = num();
+            wlits.push_back({lit, num()});
+        }
+        return Potassco::toSpan(wlits);
+    };
+    while (it != chunk.end()) {
+        switch (static_cast<Op>(word())) {
+            case Op::Rule: {
+                auto ht = static_cast<Head_t>(word());
+                auto head = atomSpan();
+                out_->rule(ht, head, litSpan());
+                break;
+            }
+            case Op::WeightRule: {
+                auto ht = static_cast<Head_t>(word());
+                auto head = atomSpan();
+                auto bound = num();
+                out_->rule(ht, head, bound, wlitSpan());
+                break;
+            }
+            case Op::Minimize: {
+                auto prio = num();
+                out_->minimize(prio, wlitSpan());
+                break;
+            }
+            case Op::Project: {
+                out_->project(atomSpan());
+                break;
+            }
+            case Op::OutputAtom: {
+                auto s = sym();
+                out_->output(s, word());
+                break;
+            }
+            case Op::OutputTerm: {
+                auto s = sym();
+                out_->output(s, litSpan());
+                break;
+            }
+            case Op::OutputCSP: {
+                auto s = sym();
+                auto value = num();
+                out_->output(s, value, litSpan());
+                break;
+            }
+            case Op::External: {
+                auto a = word();
+                out_->external(a, static_cast<Value_t>(word()));
+                break;
+            }
+            case Op::Assume: {
+                out_->assume(litSpan());
+                break;
+            }
+            case Op::Heuristic: {
+                auto a = word();
+                auto t = static_cast<Heuristic_t>(word());
+                auto bias = num();
+                auto prio = word();
+                out_->heuristic(a, t, bias, prio, litSpan());
+                break;
+            }
+            case Op::AcycEdge: {
+                auto s = num();
+                auto t = num();
+                out_->acycEdge(s, t, litSpan());
+                break;
+            }
+        }
+    }
+}
+
+void PipelinedBackend::initProgram(bool incremental) {
+    sync();
+    out_->initProgram(incremental);
+}
+
+void PipelinedBackend::beginStep() {
+    sync();
+    out_->beginStep();
+}
+
+void PipelinedBackend::rule(Head_t ht, const AtomSpan& head, const LitSpan& body) {
+    push(Op::Rule);
+    push(static_cast<uint32_t>(ht));
+    push(head);
+    push(body);
+    commit();
+}
+
+void PipelinedBackend::rule(Head_t ht, const AtomSpan& head, Weight_t bound, const WeightLitSpan& body) {
+    push(Op::WeightRule);
+    push(static_cast<uint32_t>(ht));
+    push(head);
+    push(bound);
+    push(body);
+    commit();
+}
+
+void PipelinedBackend::minimize(Weight_t prio, const WeightLitSpan& lits) {
+    push(Op::Minimize);
+    push(prio);
+    push(lits);
+    commit();
+}
+
+void PipelinedBackend::project(const AtomSpan& atoms) {
+    push(Op::Project);
+    push(atoms);
+    commit();
+}
+
+void PipelinedBackend::output(Symbol sym, Potassco::Atom_t atom) {
+    push(Op::OutputAtom);
+    push(sym);
+    push(atom);
+    commit();
+}
+
+void PipelinedBackend::output(Symbol sym, Potassco::LitSpan const& condition) {
+    push(Op::OutputTerm);
+    push(sym);
+    push(condition);
+    commit();
+}
+
+void PipelinedBackend::output(Symbol sym, int value, Potassco::LitSpan const& condition) {
+    push(Op::OutputCSP);
+    push(sym);
+    push(value);
+    push(condition);
+    commit();
+}
+
+void PipelinedBackend::external(Atom_t a, Value_t v) {
+    push(Op::External);
+    push(a);
+    push(static_cast<uint32_t>(v));
+    commit();
+}
+
+void PipelinedBackend::assume(const LitSpan& lits) {
+    push(Op::Assume);
+    push(lits);
+    commit();
+}
+
+void PipelinedBackend::heuristic(Atom_t a, Heuristic_t t, int bias, unsigned prio, const LitSpan& condition) {
+    push(Op::Heuristic);
+    push(a);
+    push(static_cast<uint32_t>(t));
+    push(bias);
+    push(prio);
+    push(condition);
+    commit();
+}
+
+void PipelinedBackend::acycEdge(int s, int t, const LitSpan& condition) {
+    push(Op::AcycEdge);
+    push(s);
+    push(t);
+    push(condition);
+    commit();
+}
+
+void PipelinedBackend::theoryTerm(Id_t termId, int number) {
+    sync();
+    out_->theoryTerm(termId, number);
+}
+
+void PipelinedBackend::theoryTerm(Id_t termId, const StringSpan& name) {
+    sync();
+    out_->theoryTerm(termId, name);
+}
+
+void PipelinedBackend::theoryTerm(Id_t termId, int cId, const IdSpan& args) {
+    sync();
+    out_->theoryTerm(termId, cId, args);
+}
+
+void PipelinedBackend::theoryElement(Id_t elementId, const IdSpan& terms, const LitSpan& cond) {
+    sync();
+    out_->theoryElement(elementId, terms, cond);
+}
+
+void PipelinedBackend::theoryAtom(Id_t atomOrZero, Id_t termId, const IdSpan& elements) {
+    sync();
+    out_->theoryAtom(atomOrZero, termId, elements);
+}
+
+void PipelinedBackend::theoryAtom(Id_t atomOrZero, Id_t termId, const IdSpan& elements, Id_t op, Id_t rhs) {
+    sync();
+    out_->theoryAtom(atomOrZero, termId, elements, op, rhs);
+}
+
+void PipelinedBackend::endStep() {
+    sync();
+    out_->endStep();
+}
+
+PipelinedBackend::~PipelinedBackend() noexcept {
+    // statements not followed by a barrier are still passed to the backend
+    try         { flush(); }
+    catch (...) { }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    ready_.notify_one();
+    thread_.join();
+}
+#endif
+
+// {{{1 definition of SymbolSink
+
+SymbolSink::SymbolSink() = default;
+
+String SymbolSink::name(char const *name) {
+    auto it = names_.find(name);
+    if (it == names_.end()) {
+        String str(name);
+        it = names_.emplace(str.c_str(), str).first;
+    }
+    return it->second;
+}
+
+Symbol SymbolSink::pop() {
+    auto &top = stack_.back();
+    auto sym = Symbol::createFun(top.first, SymSpan{args_.data() + top.second, args_.size() - top.second});
+    args_.resize(top.second);
+    stack_.pop_back();
+    return sym;
+}
+
+void SymbolSink::beginFact(char const *name) {
+    stack_.emplace_back(this->name(name), args_.size());
+}
+
+void SymbolSink::beginFunction(char const *name) {
+    stack_.emplace_back(this->name(name), args_.size());
+}
+
+void SymbolSink::endFunction() {
+    auto sym = pop();
+    args_.emplace_back(sym);
+}
+
+void SymbolSink::number(int num) {
+    args_.emplace_back(Symbol::createNum(num));
+}
+
+void SymbolSink::identifier(char const *name) {
+    args_.emplace_back(Symbol::createId(this->name(name)));
+}
+
+void SymbolSink::string(StringSpan const &str) {
+    args_.emplace_back(Symbol::createStr(String(str)));
+}
+
+void SymbolSink::term(StringSpan const &str) {
+    if (term_.type() == SymbolType::Special) {
+        if (!parser_) { parser_ = gringo_make_unique<Input::GroundTermParser>(); }
+        Logger log;
+        term_ = parser_->parse(std::string(str.first, str.size), log);
+        if (term_.type() == SymbolType::Special) { throw std::runtime_error("parsing failed"); }
+    }
+    args_.emplace_back(term_);
+    term_ = Symbol();
+}
+
+void SymbolSink::endFact() {
+    facts_.emplace_back(pop());
+}
+
+SymbolSink::~SymbolSink() noexcept = default;
+
+// {{{1 definition of ReifyBackend
+
+ReifyBackend::ReifyBackend(FactCallback cb, bool calculateSCCs, bool reifySteps)
+: cb_(std::move(cb))
+, reifier_(sink_, calculateSCCs, reifySteps) { }
+
+void ReifyBackend::initProgram(bool incremental) {
+    reifier_.initProgram(incremental);
+}
+
+void ReifyBackend::beginStep() {
+    reifier_.beginStep();
+}
+
+void ReifyBackend::rule(Head_t ht, const AtomSpan& head, const LitSpan& body) {
+    reifier_.rule(ht, head, body);
+}
+
+void ReifyBackend::rule(Head_t ht, const AtomSpan& head, Weight_t bound, const WeightLitSpan& body) {
+    reifier_.rule(ht, head, bound, body);
+}
+
+void ReifyBackend::minimize(Weight_t prio, const WeightLitSpan& lits) {
+    reifier_.minimize(prio, lits);
+}
+
+void ReifyBackend::project(const AtomSpan& atoms) {
+    reifier_.project(atoms);
+}
+
+void ReifyBackend::output(Symbol sym, Potassco::Atom_t atom) {
+    Potassco::Lit_t lit = atom;
+    output(sym, atom != 0 ? Potassco::LitSpan{&lit, 1} : Potassco::LitSpan{nullptr, 0});
+}
+
+void ReifyBackend::output(Symbol sym, Potassco::LitSpan const& condition) {
+    sink_.setTerm(sym);
+    reifier_.output(StringSpan{nullptr, 0}, condition);
+}
+
+void ReifyBackend::output(Symbol sym, int value, Potassco::LitSpan const& condition) {
+    // the textual form sym=value is not a term
+    Symbol args[] = { sym, Symbol::createNum(value) };
+    output(Symbol::createTuple(SymSpan{args, 2}), condition);
+}
+
+void ReifyBackend::external(Atom_t a, Value_t v) {
+    reifier_.external(a, v);
+}
+
+void ReifyBackend::assume(const LitSpan& lits) {
+    reifier_.assume(lits);
+}
+
+void ReifyBackend::heuristic(Atom_t a, Heuristic_t t, int bias, unsigned prio, const LitSpan& condition) {
+    reifier_.heuristic(a, t, bias, prio, condition);
+}
+
+void ReifyBackend::acycEdge(int s, int t, const LitSpan& condition) {
+    reifier_.acycEdge(s, t, condition);
+}
+
+void ReifyBackend::theoryTerm(Id_t termId, int number) {
+    reifier_.theoryTerm(termId, number);
+}
+
+void ReifyBackend::theoryTerm(Id_t termId, const StringSpan& name) {
+    reifier_.theoryTerm(termId, name);
+}
+
+void ReifyBackend::theoryTerm(Id_t termId, int cId, const IdSpan& args) {
+    reifier_.theoryTerm(termId, cId, args);
+}
+
+void ReifyBackend::theoryElement(Id_t elementId, const IdSpan& terms, const LitSpan& cond) {
+    reifier_.theoryElement(elementId, terms, cond);
+}
+
+void ReifyBackend::theoryAtom(Id_t atomOrZero, Id_t termId, const IdSpan& elements) {
+    reifier_.theoryAtom(atomOrZero, termId, elements);
+}
+
+void ReifyBackend::theoryAtom(Id_t atomOrZero, Id_t termId, const IdSpan& elements, Id_t op, Id_t rhs) {
+    reifier_.theoryAtom(atomOrZero, termId, elements, op, rhs);
+}
+
+void ReifyBackend::endStep() {
+    reifier_.endStep();
+    auto &facts = sink_.facts();
+    cb_(SymSpan{facts.data(), facts.size()});
+    facts.clear();
+}
+
+// }}}1
+
+} } // namespace Output Gringo
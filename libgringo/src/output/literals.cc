@@ -27,6 +27,7 @@
 #include <gringo/logger.hh>
 #include <gringo/output/aggregates.hh>
 #include <gringo/output/theory.hh>
+#include <gringo/subsetsum.hh>
 
 namespace Gringo { namespace Output {
 
@@ -470,13 +471,12 @@ AssignmentAggregateData::Values AssignmentAggregateData::values() const {
             return values;
         }
         default: {
-            UniqueVec<Symbol> values;
-            auto it = values_.begin();
-            values.push(*it++);
-            for (auto ie = values_.end(); it != ie; ++it) {
-                for (Id_t jt = 0, je = values.size(); jt != je; ++jt) { values.push(Symbol::createNum(values[jt].num() + it->num())); }
-            }
-            return {values.begin(), values.end()};
+            std::vector<int64_t> weights;
+            weights.reserve(values_.size() - 1);
+            for (auto it = values_.begin() + 1, ie = values_.end(); it != ie; ++it) { weights.emplace_back(it->num()); }
+            Values values;
+            for (auto sum : subsetSums(values_.front().num(), weights)) { values.emplace_back(Symbol::createNum(static_cast<int>(sum))); }
+            return values;
         }
     }
 }
@@ -873,15 +873,17 @@ void HeadAggregateAtom::accumulate(DomainData &data, Location const &loc, SymVec
 
 // {{{1 definition of PredicateDomain
 
-std::pair<Id_t, Id_t> PredicateDomain::cleanup(AssignmentLookup assignment, Mapping &map) {
+std::pair<Id_t, Id_t> PredicateDomain::cleanup(AssignmentLookup assignment, Mapping &map, Id_t forgetBegin, Id_t forgetEnd) {
     Id_t facts = 0;
     Id_t deleted = 0;
     Id_t oldOffset = 0;
     Id_t newOffset = 0;
+    Id_t forgetBeginOffset = forgetBegin < forgetEnd ? stepOffset(forgetBegin) : 0;
+    Id_t forgetEndOffset = forgetBegin < forgetEnd ? stepOffset(forgetEnd) : 0;
     reset();
     //std::cerr << "cleaning " << sig_ << std::endl;
     atoms_.erase([&](PredicateAtom &atom) {
-        if (!atom.defined()) {
+        if (!atom.defined() || (forgetBeginOffset <= oldOffset && oldOffset < forgetEndOffset)) {
             ++deleted;
             ++oldOffset;
             return true;
@@ -921,12 +923,32 @@ std::pair<Id_t, Id_t> PredicateDomain::cleanup(AssignmentLookup assignment, Mapp
     //for (auto &atom : atoms_) {
     //    std::cerr << "  " << static_cast<Symbol>(atom) << "=" << (atoms_.find(static_cast<Symbol>(atom)) != atoms_.end()) << "/" << atom.generation() << "/" << atom.defined() << "/" << atom.delayed() << std::endl;
     //}
+    // the partitions are renumbered instead of being rebuilt from scratch
+    for (auto &part : partitions_) {
+        auto &offsets = part.second.offsets;
+        for (auto it = offsets.begin(); it != offsets.end(); ) {
+            auto jt = it->second.begin();
+            for (auto &offset : it->second) {
+                Id_t mapped = map.get(offset);
+                if (mapped != InvalidId) { *jt++ = mapped; }
+            }
+            it->second.erase(jt, it->second.end());
+            if (it->second.empty()) { it = offsets.erase(it); }
+            else                    { ++it; }
+        }
+        part.second.imported = map.bound(part.second.imported);
+    }
     delayed_.clear();
     generation_ = 1;
     initOffset_ = atoms_.size();
     initDelayedOffset_ = 0;
     incOffset_ = map.bound(incOffset_);
     showOffset_ = map.bound(showOffset_);
+    for (auto &x : stepOffsets_) { x.second = map.bound(x.second); }
+    // steps whose atoms have all been removed are merged with the next step
+    stepOffsets_.erase(stepOffsets_.begin(), std::unique(stepOffsets_.rbegin(), stepOffsets_.rend(), [](std::pair<Id_t, SizeType> const &a, std::pair<Id_t, SizeType> const &b) {
+        return a.second == b.second;
+    }).base());
     return {facts, deleted};
 }
 
@@ -1009,8 +1031,18 @@ LiteralId PredicateLiteral::translate(Translator &trans) {
 }
 
 int PredicateLiteral::uid() const {
-    auto &atom = data_.predDoms()[id_.domain()]->operator[](id_.offset());
+    auto &dom = *data_.predDoms()[id_.domain()];
+    auto &atom = dom[id_.offset()];
     if (!atom.hasUid()) { atom.setUid(data_.newAtom()); }
+    else if (dom.isProjection() && data_.isPreviousAtom(atom.uid()) && !atom.fact()) {
+        // The idea here is to assign a fresh uid to a projection atom from a
+        // previous step once it is used again.
+        // Furthermore, the fresh atom is derived by the old atom.
+        // This prevents redefinition errors from projections.
+        Potassco::Atom_t newUid = data_.newAtom();
+        data_.linkAtom(newUid, atom.uid());
+        atom.resetUid(newUid);
+    }
     switch (id_.sign()) {
         case NAF::POS:    { return +static_cast<Potassco::Lit_t>(atom.uid()); }
         case NAF::NOT:    { return -static_cast<Potassco::Lit_t>(atom.uid()); }
@@ -148,7 +148,21 @@ BackendOutput::BackendOutput(UBackend &&out)
 : out_(std::move(out)) { }
 
 void BackendOutput::output(DomainData &data, Statement &stm) {
+    outputLinks(data);
     stm.output(data, out_);
+    outputLinks(data);
+}
+
+void BackendOutput::outputLinks(DomainData &data) {
+    auto &links = data.atomLinks();
+    for (auto &link : links) {
+        BackendAtomVec &hd = data.tempAtoms();
+        hd.emplace_back(link.first);
+        BackendLitVec &bd = data.tempLits();
+        bd.emplace_back(static_cast<Potassco::Lit_t>(link.second));
+        outputRule(*out_, false, hd, bd);
+    }
+    links.clear();
 }
 
 // {{{1 definition of OutputBase
@@ -259,6 +273,13 @@ UAbstractOutput OutputBase::fromFormat(std::ostream &stream, OutputFormat format
 
 UAbstractOutput OutputBase::fromBackend(UBackend &&backend, OutputOptions opts) {
     UAbstractOutput out;
+#if CLASP_HAS_THREADS
+    if (opts.pipeline) {
+        backend = gringo_make_unique<PipelinedBackend>(std::move(backend));
+    }
+#else
+    if (opts.pipeline) { throw std::runtime_error("option --pipeline requires thread support"); }
+#endif
     out = gringo_make_unique<BackendOutput>(std::move(backend));
     if (opts.debug == OutputDebug::TRANSLATE || opts.debug == OutputDebug::ALL) {
         out = gringo_make_unique<TextOutput>("%% ", std::cerr, std::move(out));
@@ -305,6 +326,7 @@ void OutputBase::endStep(bool solve, Logger &log) {
         outPredsForce.clear();
     }
     EndStepStatement(outPreds, solve, log).passTo(data, *out_);
+    data.clearPreviousAtoms();
     // TODO: get rid of such things #d domains should be stored somewhere else
     std::set<Sig> rm;
     for (auto &x : predDoms()) {
@@ -371,7 +393,7 @@ std::pair<PredicateDomain::Iterator, PredicateDomain*> OutputBase::find(Symbol v
     return {PredicateDomain::Iterator(), nullptr};
 }
 
-std::pair<Id_t, Id_t> OutputBase::simplify(AssignmentLookup assignment) {
+std::pair<Id_t, Id_t> OutputBase::simplify(AssignmentLookup assignment, Id_t forgetBegin, Id_t forgetEnd) {
     Id_t facts = 0;
     Id_t deleted = 0;
     if (true) {
@@ -379,7 +401,7 @@ std::pair<Id_t, Id_t> OutputBase::simplify(AssignmentLookup assignment) {
         std::vector<Mapping> mappings;
         for (auto &dom : data.predDoms()) {
             mappings.emplace_back();
-            auto ret = dom->cleanup(assignment, mappings.back());
+            auto ret = dom->cleanup(assignment, mappings.back(), forgetBegin, forgetEnd);
             facts+= ret.first;
             deleted+= ret.second;
         }
@@ -0,0 +1,123 @@
+// {{{ MIT License
+
+// Copyright 2017 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#include "gringo/subsetsum.hh"
+#include <algorithm>
+#include <utility>
+
+namespace Gringo {
+
+namespace {
+
+using Word = uint64_t;
+constexpr uint64_t wordBits = 64;
+// NOTE: bitsets covering more sums than this fall back to intervals
+constexpr uint64_t maxDenseRange = uint64_t(1) << 27;
+
+// The bit with index i in the bitset represents the sum offset + i. The words
+// are or-ed with shifted copies of themselves. Each loop reads only words
+// that it has not written yet and vectorizes well.
+std::vector<int64_t> denseSums(int64_t base, std::vector<int64_t> const &weights, int64_t offset, uint64_t range) {
+    std::vector<Word> bits(range / wordBits + 1, 0);
+    uint64_t minBit = -offset, maxBit = -offset;
+    bits[minBit / wordBits] = Word(1) << (minBit % wordBits);
+    for (auto w : weights) {
+        if (w > 0) {
+            uint64_t q = w / wordBits, r = w % wordBits;
+            size_t lo = (minBit + w) / wordBits, hi = (maxBit + w) / wordBits;
+            for (size_t d = hi + 1; d-- > lo; ) {
+                Word word = bits[d - q] << r;
+                if (r > 0 && d > q) { word |= bits[d - q - 1] >> (wordBits - r); }
+                bits[d] |= word;
+            }
+            maxBit += w;
+        }
+        else if (w < 0) {
+            uint64_t s = -w, q = s / wordBits, r = s % wordBits;
+            size_t lo = (minBit - s) / wordBits, hi = (maxBit - s) / wordBits;
+            for (size_t d = lo; d <= hi; ++d) {
+                Word word = bits[d + q] >> r;
+                if (r > 0 && d + q + 1 < bits.size()) { word |= bits[d + q + 1] << (wordBits - r); }
+                bits[d] |= word;
+            }
+            minBit -= s;
+        }
+    }
+    std::vector<int64_t> ret;
+    for (size_t d = minBit / wordBits, e = maxBit / wordBits; d <= e; ++d) {
+        for (Word word = bits[d], i = 0; word != 0; word >>= 1, ++i) {
+            if (word & 1) { ret.emplace_back(base + offset + static_cast<int64_t>(d * wordBits + i)); }
+        }
+    }
+    return ret;
+}
+
+// The reachable sums are kept as sorted, disjoint, and non-adjacent closed
+// intervals, which are merged with their shifted copies.
+std::vector<int64_t> intervalSums(int64_t base, std::vector<int64_t> const &weights) {
+    using Interval = std::pair<int64_t, int64_t>;
+    std::vector<Interval> current{{0, 0}}, shifted, merged;
+    for (auto w : weights) {
+        if (w == 0) { continue; }
+        shifted.clear();
+        for (auto &x : current) { shifted.emplace_back(x.first + w, x.second + w); }
+        merged.clear();
+        auto add = [&merged](Interval const &x) {
+            if (!merged.empty() && x.first <= merged.back().second + 1) {
+                merged.back().second = std::max(merged.back().second, x.second);
+            }
+            else { merged.emplace_back(x); }
+        };
+        auto it = current.begin(), ie = current.end(), jt = shifted.begin(), je = shifted.end();
+        while (it != ie && jt != je) { add(it->first < jt->first ? *it++ : *jt++); }
+        for (; it != ie; ++it) { add(*it); }
+        for (; jt != je; ++jt) { add(*jt); }
+        std::swap(current, merged);
+    }
+    std::vector<int64_t> ret;
+    for (auto &x : current) {
+        for (auto i = x.first; i <= x.second; ++i) { ret.emplace_back(base + i); }
+    }
+    return ret;
+}
+
+} // namespace
+
+std::vector<int64_t> subsetSums(int64_t base, std::vector<int64_t> const &weights) {
+    int64_t neg = 0, pos = 0;
+    size_t n = 0;
+    for (auto w : weights) {
+        if (w < 0)      { neg += w; ++n; }
+        else if (w > 0) { pos += w; ++n; }
+    }
+    uint64_t range = static_cast<uint64_t>(pos - neg) + 1;
+    // NOTE: the bitset only pays off if the range is not much larger than the
+    //       number of sums that can possibly be reached
+    if (range <= maxDenseRange && (n >= wordBits || range / wordBits <= (uint64_t(1) << n))) {
+        return denseSums(base, weights, neg, range);
+    }
+    return intervalSums(base, weights);
+}
+
+} // namespace Gringo
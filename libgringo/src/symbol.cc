@@ -482,6 +482,61 @@ void Symbol::print(std::ostream& out) const {
     }
 }
 
+namespace {
+
+void printNum(std::string& out, int num) {
+    char buf[16];
+    char *it = buf + sizeof(buf);
+    // negate as unsigned to handle the smallest integer
+    unsigned n = num < 0 ? 0u - static_cast<unsigned>(num) : static_cast<unsigned>(num);
+    do {
+        *--it = static_cast<char>('0' + n % 10);
+        n /= 10;
+    }
+    while (n > 0);
+    if (num < 0) { *--it = '-'; }
+    out.append(it, buf + sizeof(buf));
+}
+
+} // namespace
+
+void Symbol::print(std::string& out) const {
+    switch(symbolType_(rep_)) {
+        case SymbolType_::Num: { printNum(out, num()); break; }
+        case SymbolType_::IdN: { out.push_back('-'); }
+        case SymbolType_::IdP: {
+            char const *n = name().c_str();
+            out.append(n[0] != '\0' ? n : "()"); break;
+        }
+        case SymbolType_::Str: {
+            char const *str = string().c_str();
+            out.push_back('"');
+            quote(out, {str, strlen(str)});
+            out.push_back('"');
+            break;
+        }
+        case SymbolType_::Inf: { out.append("#inf"); break; }
+        case SymbolType_::Sup: { out.append("#sup"); break; }
+        case SymbolType_::Fun: {
+            auto s = sig();
+            if (s.sign()) { out.push_back('-'); }
+            out.append(s.name().c_str());
+            auto a = args();
+            out.push_back('(');
+            for (auto it = begin(a), ie = end(a); it != ie; ++it) {
+                if (it != begin(a)) { out.push_back(','); }
+                it->print(out);
+            }
+            if (a.size == 1 && s.name() == "") {
+                out.push_back(',');
+            }
+            out.push_back(')');
+            break;
+        }
+        case SymbolType_::Special: { out.append("#special"); break; }
+    }
+}
+
 // }}}2
 
 // }}}1
@@ -867,8 +867,22 @@ UTerm ValTerm::renameVars(RenameMap &) const { return UTerm(clone()); }
 
 UGTerm ValTerm::gterm(RenameMap &, ReferenceMap &) const { return gringo_make_unique<GValTerm>(value); }
 
+namespace {
+
+void collectSymbolIds(Symbol value, Term::VarSet &x) {
+    if (value.type() == SymbolType::Fun) {
+        if (value.sig().arity() == 0) { x.emplace(value.name()); }
+        else {
+            // ground function terms are folded into values by the parser
+            for (auto &arg : value.args()) { collectSymbolIds(arg, x); }
+        }
+    }
+}
+
+} // namespace
+
 void ValTerm::collectIds(VarSet &x) const {
-    if (value.type() == SymbolType::Fun && value.sig().arity() == 0) { x.emplace(value.name()); }
+    collectSymbolIds(value, x);
 }
 
 UTerm ValTerm::replace(Defines &x, bool replace) {
@@ -1924,6 +1938,58 @@ bool FunctionTerm::isAtom() const {
 
 FunctionTerm::~FunctionTerm() { }
 
+// {{{1 definition of FlatMatcher
+
+FlatMatcher::FlatMatcher(Term const &term)
+: term_(&term)
+, match_(&matchTerm)
+, sig_("", 0, false) {
+    static MatchFun const flat[] = {
+        &matchFlat<1>, &matchFlat<2>, &matchFlat<3>, &matchFlat<4>,
+        &matchFlat<5>, &matchFlat<6>, &matchFlat<7>, &matchFlat<8>
+    };
+    auto fun = dynamic_cast<FunctionTerm const*>(&term);
+    if (!fun || fun->args.empty() || fun->args.size() > MaxArity) { return; }
+    uint32_t i = 0;
+    for (auto &arg : fun->args) {
+        if (auto t = dynamic_cast<ValTerm const*>(arg.get())) {
+            args_[i] = Arg::Val;
+            vals_[i] = t->value;
+            refs_[i] = nullptr;
+        }
+        else if (auto t = dynamic_cast<VarTerm const*>(arg.get())) {
+            args_[i] = t->bindRef ? Arg::Bind : Arg::Compare;
+            refs_[i] = t->ref.get();
+        }
+        else { return; }
+        ++i;
+    }
+    sig_ = Sig(fun->name, i, false);
+    match_ = flat[i - 1];
+}
+
+bool FlatMatcher::flat() const {
+    return match_ != &matchTerm;
+}
+
+template <uint32_t N>
+bool FlatMatcher::matchFlat(FlatMatcher const &m, Symbol const &x) {
+    if (x.type() != SymbolType::Fun || x.sig().rep() != m.sig_.rep()) { return false; }
+    Symbol const *args = x.args().first;
+    for (uint32_t i = 0; i != N; ++i) {
+        switch (m.args_[i]) {
+            case Arg::Val:     { if (args[i].rep() != m.vals_[i].rep()) { return false; } break; }
+            case Arg::Compare: { if (args[i].rep() != m.refs_[i]->rep()) { return false; } break; }
+            case Arg::Bind:    { *m.refs_[i] = args[i]; break; }
+        }
+    }
+    return true;
+}
+
+bool FlatMatcher::matchTerm(FlatMatcher const &m, Symbol const &x) {
+    return m.term_->match(x);
+}
+
 // }}}1
 
 } // namespace Gringo
@@ -37,7 +37,40 @@ using namespace Gringo::IO;
 
 namespace {
 
-std::string ground(std::string const &str, std::initializer_list<std::string> filter = {""}) {
+struct BatchContext : Context {
+    bool callable(String name) override { return name == "succ" || name == "dbl" || name == "id"; }
+    bool batchable(String name) override { return name != "id"; }
+    SymVec call(Location const &, String name, SymSpan args, Logger &) override {
+        ++calls;
+        int num = args.first[0].num();
+        if (name == "id") {
+            ++idCalls;
+            return {Symbol::createNum(num)};
+        }
+        return {Symbol::createNum(name == "succ" ? num + 1 : 2 * num)};
+    }
+    std::vector<SymVec> callBatch(Location const &loc, String name, std::vector<SymVec> const &args, Logger &log) override {
+        ++batches;
+        return Context::callBatch(loc, name, args, log);
+    }
+    void exec(ScriptType, Location, String) override { throw std::runtime_error("not implemented"); }
+    unsigned calls = 0;
+    unsigned idCalls = 0;
+    unsigned batches = 0;
+};
+
+// Cancels grounding when @stop is called.
+struct CancelContext : Context {
+    bool callable(String name) override { return name == "stop"; }
+    SymVec call(Location const &, String, SymSpan args, Logger &) override {
+        progress.cancel();
+        return {args.first[0]};
+    }
+    void exec(ScriptType, Location, String) override { throw std::runtime_error("not implemented"); }
+    GroundProgress progress;
+};
+
+std::string ground(std::string const &str, std::initializer_list<std::string> filter = {""}, Context *ctx = nullptr) {
     std::regex delayedDef("^#delayed\\(([0-9]+)\\) <=> (.*)$");
     std::regex delayedOcc("#delayed\\(([0-9]+)\\)");
     std::map<std::string, std::string> delayedMap;
@@ -48,7 +81,8 @@ std::string ground(std::string const &str, std::initializer_list<std::string> fi
     Input::Program prg;
     Defines defs;
     Gringo::Test::TestGringoModule module;
-    Gringo::Test::TestContext context;
+    Gringo::Test::TestContext testContext;
+    Context &context = ctx ? *ctx : testContext;
     Input::NongroundProgramBuilder pb{ context, prg, out, defs };
     bool incmode;
     Input::NonGroundParser ngp{ pb, incmode };
@@ -284,6 +318,54 @@ TEST_CASE("ground-instantiation", "[ground]") {
                 "p(5,6)."
                 "p(6,7)."
                 "p(X,Z) :- p(X,Y), p(Y,Z)."));
+        REQUIRE(
+            "a(1).\n" "a(2).\n" "a(3).\n"
+            "b(1).\n" "b(2).\n" "b(3).\n"
+            "c(1,2).\n" "c(1,3).\n" "c(2,3).\n"
+            "d(1,1).\n" "d(1,2).\n" "d(2,2).\n" "d(3,3).\n"
+            "e(\"s\").\n" "e(1).\n" "e(2).\n" "e(3).\n" "e(f).\n" == ground(
+                "a(1..3)."
+                "b(1)."
+                "b(Y) :- a(Y), b(X), X < Y."
+                "c(X,Y) :- b(X), b(Y), X < Y."
+                "e(1;2;3;f;\"s\")."
+                "d(X,Y) :- a(X), e(Y), X <= Y, Y < X+2, Y < 3+X/3."));
+        REQUIRE(
+            "m(0,0).\n" "m(0,1).\n" "m(0,2).\n" "m(1,1).\n" "m(1,2).\n" "m(2,2).\n"
+            "n(0).\n" "n(1).\n" "n(2).\n" "n(3).\n" "n(4).\n" "n(5).\n" == ground(
+                "n(0)."
+                "n(X+1) :- n(X), X < 5."
+                "m(0,0)."
+                "m(X,Y+1) :- m(X,Y), Y < 2."
+                "m(X+1,Y) :- m(X,Y), X < Y."));
+        REQUIRE(
+            "n(1000000).\n"
+            "p(2).\n"
+            "p(5).\n"
+            "p(2000000).\n"
+            "q(2).\n"
+            "q(5).\n" == ground(
+                "n(1000000)."
+                "p(2;5;2000000)."
+                "q(X) :- n(N), X=1..N, p(X)."));
+        REQUIRE(
+            "p(1,a).\n"
+            "p(1,b).\n"
+            "p(1,c).\n"
+            "p(2,a).\n"
+            "p(2,b).\n"
+            "p(2,c).\n"
+            "p(3,a).\n"
+            "p(3,b).\n"
+            "p(3,c).\n"
+            "q(1).\n"
+            "q(2).\n"
+            "q(3).\n"
+            "r(2).\n"
+            "s(b).\n" == ground(
+                "p((1;2;3),(a;b;c))."
+                "r(2). s(b)."
+                "q(X) :- p(X,a), r(1;2;3;4), s(a;b;c)."));
         REQUIRE(
             "x.\n"
             "y.\n"
@@ -1125,6 +1207,104 @@ TEST_CASE("ground-instantiation", "[ground]") {
         REQUIRE("p(((),())).\n" == ground("p(((),())).\n"));
     }
 
+    SECTION("batch") {
+        BatchContext ctx;
+        REQUIRE(
+            "p(1).\n"
+            "p(2).\n"
+            "p(3).\n"
+            "q(2).\n"
+            "q(3).\n"
+            "q(4).\n"
+            "r(4).\n"
+            "r(6).\n"
+            "r(8).\n" == ground(
+                "p(1..3).\n"
+                "q(@succ(X)) :- p(X).\n"
+                "r(@dbl(@succ(X))) :- p(X).\n", {""}, &ctx));
+        REQUIRE(3 == ctx.batches);
+        REQUIRE(9 == ctx.calls);
+    }
+    SECTION("cancel") {
+        // domains of a cancelled step are used again in the next step
+        std::stringstream ss;
+        Potassco::TheoryData td;
+        Output::OutputBase out(td, {}, ss, Output::OutputFormat::TEXT);
+        Input::Program prg;
+        Defines defs;
+        Gringo::Test::TestGringoModule module;
+        CancelContext context;
+        Input::NongroundProgramBuilder pb{ context, prg, out, defs };
+        bool incmode;
+        Input::NonGroundParser ngp{ pb, incmode };
+        ngp.pushStream("-", gringo_make_unique<std::stringstream>(
+            "p(1). p(X+1) :- p(X), X < 10, X = @stop(X)."
+            "#program step. p(20). p(X+1) :- p(X), 20 <= X, X < 23."), module);
+        ngp.parse(module);
+        prg.rewrite(defs, module);
+        Parameters base;
+        base.add("base", {});
+        REQUIRE_THROWS_AS(prg.toGround(base, out.data, module).ground(base, context, out, true, module, &context.progress), GroundCancelled);
+        REQUIRE(ss.str().find("p(10).") == std::string::npos);
+        ss.str("");
+        Parameters step;
+        step.add("step", {});
+        prg.toGround(step, out.data, module).ground(step, context, out, true, module);
+        for (auto atom : {"p(20).", "p(21).", "p(22).", "p(23)."}) {
+            REQUIRE(ss.str().find(atom) != std::string::npos);
+        }
+    }
+
+    SECTION("batch-mixed") {
+        BatchContext ctx;
+        REQUIRE(
+            "p(1).\n"
+            "p(2).\n"
+            "p(3).\n"
+            "q(2).\n"
+            "q(3).\n"
+            "q(4).\n"
+            "s(2).\n"
+            "s(3).\n"
+            "s(4).\n" == ground(
+                "p(1..3).\n"
+                "q(@succ(X)) :- p(X).\n"
+                "s(@succ(@id(X))) :- p(X).\n", {""}, &ctx));
+        // rules calling functions that cannot be batched are not batched
+        REQUIRE(1 == ctx.batches);
+        REQUIRE(3 == ctx.idCalls);
+        REQUIRE(9 == ctx.calls);
+    }
+    SECTION("cancel") {
+        // domains of a cancelled step are used again in the next step
+        std::stringstream ss;
+        Potassco::TheoryData td;
+        Output::OutputBase out(td, {}, ss, Output::OutputFormat::TEXT);
+        Input::Program prg;
+        Defines defs;
+        Gringo::Test::TestGringoModule module;
+        CancelContext context;
+        Input::NongroundProgramBuilder pb{ context, prg, out, defs };
+        bool incmode;
+        Input::NonGroundParser ngp{ pb, incmode };
+        ngp.pushStream("-", gringo_make_unique<std::stringstream>(
+            "p(1). p(X+1) :- p(X), X < 10, X = @stop(X)."
+            "#program step. p(20). p(X+1) :- p(X), 20 <= X, X < 23."), module);
+        ngp.parse(module);
+        prg.rewrite(defs, module);
+        Parameters base;
+        base.add("base", {});
+        REQUIRE_THROWS_AS(prg.toGround(base, out.data, module).ground(base, context, out, true, module, &context.progress), GroundCancelled);
+        REQUIRE(ss.str().find("p(10).") == std::string::npos);
+        ss.str("");
+        Parameters step;
+        step.add("step", {});
+        prg.toGround(step, out.data, module).ground(step, context, out, true, module);
+        for (auto atom : {"p(20).", "p(21).", "p(22).", "p(23)."}) {
+            REQUIRE(ss.str().find(atom) != std::string::npos);
+        }
+    }
+
 }
 
 } } } // namespace Test Ground Gringo
@@ -120,6 +120,40 @@ S evalPred(L<L<V>> vals, L<P<S,V>> bound, BinderType type, NAF naf, UTerm &&repr
     return to_string(ret);
 }
 
+struct SuccContext : Context {
+    SuccContext(bool isPure) : isPure(isPure) { }
+    bool callable(String name) override { return name == "succ"; }
+    bool pure(String) override { return isPure; }
+    SymVec call(Location const &, String, SymSpan args, Logger &) override {
+        ++calls;
+        return {Symbol::createNum(args.first[0].num() + 1)};
+    }
+    void exec(ScriptType, Location, String) override { throw std::runtime_error("not implemented"); }
+    bool isPure;
+    unsigned calls = 0;
+};
+
+S evalScript(bool pure, size_t limit, L<V> vals) {
+    Gringo::Test::TestGringoModule module;
+    SuccContext script(pure);
+    MemoContext context(script, limit);
+    ScriptLiteral lit(var("Y"), "succ", termvec(var("X")));
+    Term::VarSet bound;
+    bound.emplace("X");
+    UIdx idx(lit.index(context, BinderType::ALL, bound));
+    SymVec ret;
+    U<VarTerm> x(var("X")), y(var("Y"));
+    bool undefined = false;
+    for (auto &val : vals) {
+        *x->ref = val;
+        idx->match(module.logger);
+        while (idx->next()) { ret.emplace_back(y->eval(undefined, module.logger)); }
+    }
+    std::ostringstream oss;
+    oss << to_string(ret) << " calls=" << script.calls << " hits=" << context.hits() << " misses=" << context.misses() << " size=" << context.size();
+    return oss.str();
+}
+
 }// namespace
 
 TEST_CASE("ground-literal", "[ground]") {
@@ -143,6 +177,14 @@ TEST_CASE("ground-literal", "[ground]") {
         REQUIRE("[]"                    == evalRelation(Relation::EQ, fun("f", var("X"), fun("g", var("X"))), val(FUN("f", {NUM(1), FUN("g", {NUM(2)})}))));
     }
 
+    SECTION("script") {
+        REQUIRE("[2,3,2,2] calls=4 hits=0 misses=0 size=0" == evalScript(false, 10, {NUM(1),NUM(2),NUM(1),NUM(1)}));
+        REQUIRE("[2,3,2,2] calls=2 hits=2 misses=2 size=2" == evalScript(true, 10, {NUM(1),NUM(2),NUM(1),NUM(1)}));
+        REQUIRE("[2,3,2,2] calls=3 hits=1 misses=3 size=1" == evalScript(true, 1, {NUM(1),NUM(2),NUM(1),NUM(1)}));
+        REQUIRE("[2,3,4,3] calls=3 hits=1 misses=3 size=2" == evalScript(true, 2, {NUM(1),NUM(2),NUM(3),NUM(2)}));
+        REQUIRE("[2,3,2,2] calls=4 hits=0 misses=0 size=0" == evalScript(true, 0, {NUM(1),NUM(2),NUM(1),NUM(1)}));
+    }
+
     SECTION("pred") {
         // BIND + LOOKUP + POS + OLD/NEW/ALL
         REQUIRE("[[f(1,1),f(1,2)],[f(1,1),f(1,2),f(1,3)]]" == evalPred({{FUN("f",{NUM(1),NUM(1)}),FUN("f",{NUM(2),NUM(2)}),FUN("f",{NUM(1),NUM(2)})},{FUN("f",{NUM(1),NUM(3)})}}, {{"X",NUM(1)}}, BinderType::ALL, NAF::POS, fun("f",var("X"),var("Y")), true));
@@ -172,6 +214,26 @@ TEST_CASE("ground-literal", "[ground]") {
         REQUIRE("[[],[f(1,1),f(1,2)]]"                     == evalPred({{FUN("f",{NUM(1),NUM(1)}),FUN("f",{NUM(2),NUM(2)}),FUN("f",{NUM(1),NUM(2)})},{FUN("f",{NUM(1),NUM(3)})}}, {{"X",NUM(1)}}, BinderType::OLD, NAF::POS, fun("f",var("X"),var("Y")), true));
         REQUIRE("[[f(1,1),f(1,2)],[f(1,3)]]"               == evalPred({{FUN("f",{NUM(1),NUM(1)}),FUN("f",{NUM(2),NUM(2)}),FUN("f",{NUM(1),NUM(2)})},{FUN("f",{NUM(1),NUM(3)})}}, {{"X",NUM(1)}}, BinderType::NEW, NAF::POS, fun("f",var("X"),var("Y")), true));
     }
+
+    SECTION("partition") {
+        // partitions survive a cleanup and are renumbered
+        using OffsetVec = PredicateDomain::OffsetVec;
+        PredicateDomain dom(Sig("f", 2, false));
+        dom.define(FUN("f",{NUM(0),NUM(0)}));
+        dom.reserve(FUN("f",{NUM(0),NUM(1)}));
+        dom.define(FUN("f",{NUM(1),NUM(0)}));
+        dom.define(FUN("f",{NUM(1),NUM(1)}));
+        REQUIRE((OffsetVec{1,3}) == dom.partition(1).offsets.at(NUM(1)));
+        Output::Mapping map;
+        dom.cleanup([](unsigned) { return std::make_pair(false, Potassco::Value_t::Free); }, map);
+        REQUIRE(dom.partitions().size() == 1);
+        auto &part = dom.partitions().at(1);
+        REQUIRE(part.imported == 3);
+        REQUIRE((OffsetVec{0,1}) == part.offsets.at(NUM(0)));
+        REQUIRE((OffsetVec{2}) == part.offsets.at(NUM(1)));
+        dom.define(FUN("f",{NUM(2),NUM(1)}));
+        REQUIRE((OffsetVec{2,3}) == dom.partition(1).offsets.at(NUM(1)));
+    }
 }
 
 } } } // namespace Test Ground Gringo
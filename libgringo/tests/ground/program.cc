@@ -39,7 +39,7 @@ namespace {
 
 typedef std::string S;
 
-Program parse(std::string const &str) {
+Program parse(std::string const &str, Parameters const *params = nullptr, std::string *messages = nullptr) {
     Gringo::Test::TestGringoModule module;
     std::ostringstream oss;
     Potassco::TheoryData td;
@@ -53,7 +53,11 @@ Program parse(std::string const &str) {
     ngp.pushStream("-", gringo_make_unique<std::stringstream>(str), module.logger);
     ngp.parse(module.logger);
     prg.rewrite(defs, module.logger);
-    return prg.toGround(out.data, module.logger);
+    auto ret = params
+        ? prg.toGround(*params, out.data, module.logger)
+        : prg.toGround(out.data, module.logger);
+    if (messages) { *messages = to_string(module); }
+    return ret;
 }
 
 std::string toString(Program const &p) {
@@ -230,6 +234,18 @@ TEST_CASE("ground-program", "[ground]") {
             "% positive component\n"
             "x:-p(X,Y,Z),Z<#count{#d0(Z,X,Y)}." ==
             toString(parse("x:-p(X,Y,Z),Z<#count{A:q(A),r(A,X);B,Y:a(B,Y)}.")));
+        // only the selected blocks are translated
+        Parameters params;
+        params.add("step", {});
+        REQUIRE(
+            "% component\n#external.\n"
+            "% positive component\n"
+            "q:-[#inc_step],p." ==
+            toString(parse("#program base.a.p:-a.#program step.q:-p.", &params)));
+        // atoms defined in blocks that are not grounded are not reported
+        std::string messages;
+        parse("#program base.p:-q.#program step.r:-p,s.", &params, &messages);
+        REQUIRE("[-:1:39-40: info: atom does not occur in any rule head:\n  s\n]" == messages);
     }
 
     SECTION("analyze") {
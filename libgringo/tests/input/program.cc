@@ -30,6 +30,8 @@
 #include "tests/tests.hh"
 #include "tests/term_helper.hh"
 
+#include <chrono>
+
 namespace Gringo { namespace Input { namespace Test {
 
 using namespace Gringo::IO;
@@ -96,6 +98,20 @@ TEST_CASE("input-program", "[input]") {
         REQUIRE("p(1):-q.p(2):-q.p(3):-q.p:-q." == rewrite(parse("p(1;2;3;):-q.")));
         REQUIRE("p:-q(1).p:-q(2).p:-q(3).p:-q." == rewrite(parse("p:-q(1;2;3;).")));
         REQUIRE("p(1):-q(3).p(2):-q(3).p(1):-q(4).p(2):-q(4)." == rewrite(parse("p(1;2):-q(3;4).")));
+        REQUIRE("p(#Pool0):-q(#Pool1);#pool(#Pool0,1;2;3);#pool(#Pool1,a;b;c)." == rewrite(parse("p(1;2;3):-q(a;b;c).")));
+        {
+            // enough statements to be rewritten in parallel
+            std::string prg, expected;
+            for (int i = 1; i <= 2000; ++i) {
+                auto n = std::to_string(i);
+                prg += "p(X+Y):-q(X+Y),r(" + n + ").";
+                expected += "p((X+Y)):-q(#Arith0);r(" + n + ");#Arith0=(X+Y).";
+            }
+            REQUIRE(expected == rewrite(parse(prg)));
+            auto g = parse(prg);
+            g->p.setThreads(0);
+            REQUIRE(expected == rewrite(std::move(g)));
+        }
         REQUIRE("p((X+Y)):-q(#Arith0);#Arith0=(X+Y)." == rewrite(parse("p(X+Y):-q(X+Y).")));
         REQUIRE("#Arith0<=#count{(X+Y):q((X+Y)):r(#Arith0),s(#Arith1),#Arith1=(A+B)}:-t(#Arith0);#Arith0=(X+Y);1<=#count{(X+Y):u(#Arith0),v(#Arith2),#Arith2=(A+B)}." == rewrite(parse("X+Y#count{X+Y:q(X+Y):r(X+Y),s(A+B)}:-t(X+Y),1#count{X+Y:u(X+Y),v(A+B)}.")));
         REQUIRE("p(#Range0):-q(#Range1);#range(#Range1,A,B);#range(#Range0,X,Y)." == rewrite(parse("p(X..Y):-q(A..B).")));
@@ -121,6 +137,7 @@ TEST_CASE("input-program", "[input]") {
         REQUIRE("p(1,2,3)." == rewrite(parse("#const x=1.#const y=1+x.#const z=1+y.p(x,y,z).")));
         REQUIRE("a." ==        rewrite(parse("#const a=b.a.")));
         REQUIRE("a(b)." ==     rewrite(parse("#const a=b.a(a).")));
+        REQUIRE("p(f(g(1)))." == rewrite(parse("#const a=f(b).#const b=g(c).#const c=1.p(a).")));
         REQUIRE("#project p(2):-[p(2)]." == rewrite(parse("#project p(x).#const x=2.")));
         REQUIRE("#project x:-[x]." == rewrite(parse("#project x.#const x=2.")));
         REQUIRE("#edge(2,y)." == rewrite(parse("#edge(x,y).#const x=2.")));
@@ -136,6 +153,22 @@ TEST_CASE("input-program", "[input]") {
             "  p(X,Y,Z):-[#inc_base];q(X).\n"
             "-:1:5-6: note: 'Y' is unsafe\n"
             "-:1:7-8: note: 'Z' is unsafe\n]"));
+        {
+            // messages of statements checked in parallel keep their order
+            std::string prg, expected;
+            for (int i = 1; i <= 2000; ++i) {
+                if (i == 1 || i == 1000 || i == 2000) {
+                    auto n = std::to_string(i);
+                    prg += "p(X):-q(Y).\n";
+                    expected += std::string(expected.empty() ? "[" : ",") +
+                        "-:" + n + ":1-12: error: unsafe variables in:\n"
+                        "  p(X):-[#inc_base];q(Y).\n"
+                        "-:" + n + ":3-4: note: 'X' is unsafe\n";
+                }
+                else { prg += "p(X):-q(X).\n"; }
+            }
+            REQUIRE(!check(prg, expected + "]"));
+        }
         REQUIRE( check("p(X):-p(Y),X=Y+Y."));
         REQUIRE( check("p(X):-p(Y),Y+Y=X."));
         REQUIRE(!check("p(X):-p(Y),Y!=X."));
@@ -229,5 +262,23 @@ TEST_CASE("input-program", "[input]") {
 
 }
 
+TEST_CASE("input-program-bench", "[.][bench]") {
+    std::string prg;
+    for (int i = 0; i < 100000; ++i) {
+        auto n = std::to_string(i);
+        prg += "p(X+Y," + n + "):-q(X+Y,Z),r(Z*2," + n + "),#count{A:s(A,X)}>Y.\n";
+    }
+    for (unsigned threads : {1, 2, 4, 0}) {
+        auto g = parse(prg);
+        g->d.init(g->module);
+        g->p.setThreads(threads);
+        auto start = std::chrono::steady_clock::now();
+        g->p.rewrite(g->d, g->module);
+        g->p.check(g->module);
+        std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+        std::cout << "threads=" << threads << " time=" << time.count() << "s" << std::endl;
+    }
+}
+
 } } } // namespace Test Input Gringo
 
@@ -35,11 +35,13 @@ using namespace Gringo::Test;
 
 namespace {
 
-std::string iground(std::string in, int last = 3) {
+std::string iground(std::string in, int last = 3, int forget = 0, bool pipeline = false) {
     std::stringstream ss;
     Gringo::Test::TestGringoModule module;
     Potassco::TheoryData td;
-    Output::OutputBase out(td, {}, ss, OutputFormat::INTERMEDIATE);
+    Output::OutputOptions opts;
+    opts.pipeline = pipeline;
+    Output::OutputBase out(td, {}, ss, OutputFormat::INTERMEDIATE, opts);
     Input::Program prg;
     Defines defs;
     Gringo::Test::TestContext context;
@@ -53,6 +55,12 @@ std::string iground(std::string in, int last = 3) {
     prg.check(module.logger);
     //std::cerr << prg;
     // TODO: think about passing params to toGround already...
+    // forgets all but the base step and the last forget steps
+    auto cleanup = [&](int step) {
+        if (forget > 0 && step - forget > 1) {
+            out.simplify([](unsigned) { return std::make_pair(false, Potassco::Value_t::Free); }, 1, step - forget);
+        }
+    };
     if (!module.logger.hasError()) {
         out.init(true);
         {
@@ -65,6 +73,7 @@ std::string iground(std::string in, int last = 3) {
         for (int i=1; i < last; ++i) {
             Ground::Parameters params;
             params.add("step", {NUM(i)});
+            cleanup(i);
             out.beginStep();
             prg.toGround(out.data, module.logger).ground(params, context, out, true, module.logger);
             out.reset(true);
@@ -72,6 +81,7 @@ std::string iground(std::string in, int last = 3) {
         {
             Ground::Parameters params;
             params.add("last", {});
+            cleanup(last);
             out.beginStep();
             prg.toGround(out.data, module.logger).ground(params, context, out, true, module.logger);
             out.reset(true);
@@ -129,15 +139,14 @@ TEST_CASE("output-incremental", "[output]") {
             "4 4 p(2) 1 2\n"
             "4 4 p(3) 1 3\n"
             "0\n"
-            "1 0 1 5 0 1 4\n"
-            "1 1 1 6 0 1 5\n"
-            "4 4 q(1) 1 6\n"
+            "1 1 1 5 0 1 6\n"
+            "1 0 1 6 0 1 4\n"
+            "4 4 q(1) 1 5\n"
             "0\n"
-            "1 0 1 7 0 1 5\n"
-            "1 1 1 8 0 1 7\n"
-            "4 4 q(2) 1 8\n"
+            "1 1 1 7 0 1 8\n"
+            "1 0 1 8 0 1 6\n"
+            "4 4 q(2) 1 7\n"
             "0\n"
-            "1 0 1 9 0 1 7\n"
             "0\n" == iground(
                 "#program base."
                 "{p(1..3)}."
@@ -248,29 +257,28 @@ TEST_CASE("output-incremental", "[output]") {
             "1 0 1 2 0 1 1\n"
             "4 6 p(0,0) 1 1\n"
             "0\n"
-            "1 0 1 3 0 1 2\n"
-            "1 1 1 4 0 1 3\n"
-            "1 0 1 5 0 1 4\n"
-            "4 6 p(1,1) 1 4\n"
+            "1 1 1 3 0 1 4\n"
+            "1 0 1 4 0 1 2\n"
+            "1 0 1 5 0 1 3\n"
+            "4 6 p(1,1) 1 3\n"
             "0\n"
-            "1 0 1 6 0 1 3\n"
+            "1 1 1 6 0 1 7\n"
             "1 0 1 7 0 1 5\n"
-            "1 1 1 8 0 1 7\n"
-            "1 0 1 9 0 1 8\n"
-            "4 6 p(2,2) 1 8\n"
-            "0\n"
-            "1 0 1 10 0 1 6\n"
-            "1 0 1 11 0 1 7\n"
-            "1 0 1 12 0 1 9\n"
-            "1 1 1 13 0 0\n"
-            "1 0 1 10 0 1 13\n"
-            "1 1 1 14 0 1 10\n"
-            "1 1 1 15 0 1 11\n"
-            "1 1 1 16 0 1 12\n"
-            "4 6 p(1,0) 1 13\n"
-            "4 4 r(0) 1 14\n"
-            "4 4 r(1) 1 15\n"
-            "4 4 r(2) 1 16\n"
+            "1 0 1 8 0 1 6\n"
+            "4 6 p(2,2) 1 6\n"
+            "0\n"
+            "1 1 1 9 0 0\n"
+            "1 0 1 10 0 1 9\n"
+            "1 0 1 10 0 1 4\n"
+            "1 1 1 11 0 1 10\n"
+            "1 1 1 12 0 1 13\n"
+            "1 0 1 13 0 1 7\n"
+            "1 1 1 14 0 1 15\n"
+            "1 0 1 15 0 1 8\n"
+            "4 6 p(1,0) 1 9\n"
+            "4 4 r(0) 1 11\n"
+            "4 4 r(1) 1 12\n"
+            "4 4 r(2) 1 14\n"
             "0\n" == iground(
                 "#program base."
                 "{p(0,0)}."
@@ -282,6 +290,95 @@ TEST_CASE("output-incremental", "[output]") {
                 ));
     }
 
+    SECTION("partition") {
+        REQUIRE(
+            "asp 1 0 0 incremental\n"
+            "1 0 1 1 0 0\n"
+            "1 0 1 2 0 0\n"
+            "4 6 p(1,0) 0\n"
+            "4 6 p(2,0) 0\n"
+            "0\n"
+            "1 0 1 3 0 0\n"
+            "1 0 1 4 0 0\n"
+            "4 6 p(1,1) 0\n"
+            "4 6 p(2,1) 0\n"
+            "0\n"
+            "1 0 1 5 0 0\n"
+            "1 0 1 6 0 0\n"
+            "4 6 p(1,2) 0\n"
+            "4 6 p(2,2) 0\n"
+            "0\n"
+            "0\n" == iground(
+                "#program base."
+                "p(1,0)."
+                "p(2,0)."
+                "#program step(k)."
+                "p(X,k) :- p(X,k-1)."
+                "#program last."));
+    }
+
+    SECTION("forget") {
+        REQUIRE(
+            "asp 1 0 0 incremental\n"
+            "1 0 1 1 0 0\n"
+            "4 4 p(0) 0\n"
+            "0\n"
+            "1 0 1 2 0 0\n"
+            "4 4 p(1) 0\n"
+            "0\n"
+            "1 0 1 3 0 0\n"
+            "4 4 p(2) 0\n"
+            "0\n"
+            "1 0 1 4 0 0\n"
+            "4 4 p(3) 0\n"
+            "0\n"
+            "1 0 1 5 0 0\n"
+            "4 1 q 0\n"
+            "0\n" == iground(
+                "#program base."
+                "p(0)."
+                "#program step(k)."
+                "p(k) :- p(k-1)."
+                "#program last."
+                "q :- p(1).", 4));
+        REQUIRE(
+            "asp 1 0 0 incremental\n"
+            "1 0 1 1 0 0\n"
+            "4 4 p(0) 0\n"
+            "0\n"
+            "1 0 1 2 0 0\n"
+            "4 4 p(1) 0\n"
+            "0\n"
+            "1 0 1 3 0 0\n"
+            "4 4 p(2) 0\n"
+            "0\n"
+            "1 0 1 4 0 0\n"
+            "4 4 p(3) 0\n"
+            "0\n"
+            "0\n" == iground(
+                "#program base."
+                "p(0)."
+                "#program step(k)."
+                "p(k) :- p(k-1)."
+                "#program last."
+                "q :- p(1).", 4, 1));
+    }
+
+    SECTION("pipeline") {
+        std::string prg =
+            "#program base."
+            "{ a; b }."
+            "#external e."
+            "#program step(k)."
+            "{ p(k,1..20) }."
+            "q(k) :- #sum { X : p(k,X) } > 10."
+            ":~ p(k,X). [X@k]"
+            "#program last."
+            "#show q/1.";
+        REQUIRE(iground(prg, 3, 0) == iground(prg, 3, 0, true));
+        REQUIRE(iground(prg, 4, 1) == iground(prg, 4, 1, true));
+    }
+
     SECTION("mapping") {
         Mapping m;
         m.add(1,0);
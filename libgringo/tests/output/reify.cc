@@ -0,0 +1,99 @@
+// {{{ MIT License
+
+// Copyright 2017 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#include "tests/tests.hh"
+#include "gringo/output/output.hh"
+#include "gringo/output/backends.hh"
+#include "gringo/input/nongroundparser.hh"
+#include "gringo/input/programbuilder.hh"
+#include "gringo/input/program.hh"
+#include "gringo/ground/program.hh"
+
+namespace Gringo { namespace Output { namespace Test {
+
+using namespace Gringo::Test;
+
+// {{{ definition of auxiliary functions
+
+namespace {
+
+// reifies the program as text or via a symbol sink printed in text form
+std::string reify(std::string in, bool symbols) {
+    std::stringstream ss;
+    Gringo::Test::TestGringoModule module;
+    Potassco::TheoryData td;
+    SymVec facts;
+    auto cb = [&facts](SymSpan step) { facts.insert(facts.end(), begin(step), end(step)); };
+    {
+        std::unique_ptr<OutputBase> out = symbols
+            ? gringo_make_unique<OutputBase>(td, OutputPredicates{}, Gringo::gringo_make_unique<ReifyBackend>(cb, false, false))
+            : gringo_make_unique<OutputBase>(td, OutputPredicates{}, ss, OutputFormat::REIFY);
+        Input::Program prg;
+        Defines defs;
+        Gringo::Test::TestContext context;
+        Input::NongroundProgramBuilder pb(context, prg, *out, defs);
+        bool incmode;
+        Input::NonGroundParser parser(pb, incmode);
+        parser.pushStream("-", gringo_make_unique<std::stringstream>(in), module.logger);
+        parser.parse(module.logger);
+        defs.init(module.logger);
+        prg.rewrite(defs, module.logger);
+        prg.check(module.logger);
+        if (!module.logger.hasError()) {
+            Ground::Program gPrg(prg.toGround(out->data, module.logger));
+            out->init(false);
+            out->beginStep();
+            gPrg.ground(context, *out, module.logger);
+            out->endStep(true, module.logger);
+        }
+    }
+    for (auto &fact : facts) { ss << fact << ".\n"; }
+    return ss.str();
+}
+
+} // namespace
+
+// }}}
+// {{{ definition of TestReify
+
+TEST_CASE("output-reify", "[output]") {
+    SECTION("symbols") {
+        auto facts = reify("{ p(\"x\"); q(1,a) }.", true);
+        REQUIRE(facts.find("rule(choice(0),normal(0)).\n") != std::string::npos);
+        REQUIRE(facts.find("output(p(\"x\"),") != std::string::npos);
+        REQUIRE(facts.find("output(q(1,a),") != std::string::npos);
+    }
+    SECTION("compare") {
+        for (auto prg : {
+                "{ p(1..3) }. :- p(1), not p(2). q :- 2 { p(X) }.",
+                "{ a; b }. c :- a. c :- b. #minimize { 1,X : p(X); 2 : c }. #external e.",
+                "#heuristic a. [1, level] { a }. #project a. #edge (1,2) : a." }) {
+            REQUIRE(reify(prg, false) == reify(prg, true));
+        }
+    }
+}
+
+// }}}
+
+} } } // namespace Test Output Gringo
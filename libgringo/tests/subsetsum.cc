@@ -0,0 +1,94 @@
+// {{{ MIT License
+
+// Copyright 2017 Roland Kaminski
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// }}}
+
+#include "gringo/subsetsum.hh"
+#include "gringo/utility.hh"
+
+#include "tests/tests.hh"
+
+#include <chrono>
+#include <random>
+#include <set>
+
+namespace Gringo { namespace Test {
+
+using V = std::vector<int64_t>;
+
+namespace {
+
+V naiveSums(int64_t base, V const &weights) {
+    std::set<int64_t> sums{base};
+    for (auto w : weights) {
+        std::set<int64_t> next = sums;
+        for (auto x : sums) { next.insert(x + w); }
+        sums = std::move(next);
+    }
+    return {sums.begin(), sums.end()};
+}
+
+V randomWeights(std::mt19937 &gen, size_t n, int64_t spread) {
+    std::uniform_int_distribution<int64_t> dist(-spread, spread);
+    V ret;
+    for (size_t i = 0; i < n; ++i) { ret.emplace_back(dist(gen)); }
+    return ret;
+}
+
+} // namespace
+
+TEST_CASE("subsetsum", "[base]") {
+    SECTION("simple") {
+        REQUIRE(V({0}) == subsetSums(0, {}));
+        REQUIRE(V({3}) == subsetSums(3, {0, 0}));
+        REQUIRE(V({0, 1, 2, 3}) == subsetSums(0, {1, 1, 1}));
+        REQUIRE(V({-2, -1, 0, 1}) == subsetSums(0, {-2, 1}));
+        REQUIRE(V({10, 11, 12, 13, 14, 15, 16}) == subsetSums(10, {1, 2, 3}));
+    }
+    SECTION("wide") {
+        REQUIRE(V({-1000000000, -999999999, 0, 1, 1000000000, 1000000001}) == subsetSums(0, {1, 1000000000, -1000000000}));
+    }
+    SECTION("random") {
+        std::mt19937 gen(42);
+        for (int64_t spread : {5, 200, 100000000}) {
+            for (size_t n = 0; n < 12; ++n) {
+                auto weights = randomWeights(gen, n, spread);
+                REQUIRE(naiveSums(7, weights) == subsetSums(7, weights));
+            }
+        }
+    }
+}
+
+TEST_CASE("subsetsum-bench", "[.][bench]") {
+    std::mt19937 gen(42);
+    for (size_t n : {100, 300, 1000}) {
+        for (int64_t spread : {10, 1000, 100000}) {
+            auto weights = randomWeights(gen, n, spread);
+            auto start = std::chrono::steady_clock::now();
+            auto sums = subsetSums(0, weights);
+            std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+            std::cout << "n=" << n << " spread=" << spread << " sums=" << sums.size() << " time=" << time.count() << "s" << std::endl;
+        }
+    }
+}
+
+} } // namespace Test Gringo
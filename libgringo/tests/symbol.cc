@@ -193,6 +193,26 @@ TEST_CASE("symbol", "[base]") {
         REQUIRE("g(0,42,x,abc,\"\",\"xyz\",#inf,#sup,(42,a),f(42,a))" == comp);
     }
 
+    SECTION("print_string") {
+        auto toString = [](Symbol const &val) -> std::string {
+            std::string str = "[";
+            val.print(str);
+            return str;
+        };
+        std::vector<Symbol> syms = symbols;
+        syms.emplace_back(Symbol::createNum(-17));
+        syms.emplace_back(Symbol::createStr("a\"b\\c\nd"));
+        syms.emplace_back(symbols[11].flipSign());
+        syms.emplace_back(Symbol::createTuple(SymSpan{nullptr, 0}));
+        syms.emplace_back(Symbol::createTuple(SymSpan{symbols.data() + 3, 1}));
+        syms.emplace_back(Symbol::createFun("g", SymSpan{symbols.data() + 2, symbols.size() - 2}));
+        for (auto &sym : syms) {
+            std::ostringstream oss;
+            oss << "[" << sym;
+            REQUIRE(oss.str() == toString(sym));
+        }
+    }
+
     SECTION("sig") {
         std::vector<char const *> names { "a", "b", "c", "d" };
         for (uint32_t i = 1; i < 1073741824; i*=2) {
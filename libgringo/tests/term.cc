@@ -304,6 +304,33 @@ TEST_CASE("term", "[base]") {
         REQUIRE(!bindVars(fun("p", binop(BinOp::SUB, val(NUM(4)), binop(BinOp::MUL, val(NUM(3)), var("X"))), unop(UnOp::NEG, var("X"))))->match(FUN("p", {NUM(1), NUM(2)})));
     }
 
+    SECTION("flat match") {
+        auto flat = [](UTerm const &x) { return FlatMatcher(*x).flat(); };
+        auto match = [](UTerm const &x, Symbol y) { return FlatMatcher(*x).match(y); };
+        REQUIRE(flat(bindVars(fun("p", var("X"), val(ID("a")), var("Y")))));
+        REQUIRE(!flat(bindVars(val(ID("p")))));
+        REQUIRE(!flat(bindVars(fun("p", fun("f", var("X"))))));
+        REQUIRE(!flat(bindVars(fun("p", var("A"), var("B"), var("C"), var("D"), var("E"), var("F"), var("G"), var("H"), var("I")))));
+        REQUIRE(!flat(bindVars(fun("p", unop(UnOp::NEG, var("X"))))));
+
+        REQUIRE(match(bindVars(fun("p", var("X"), val(ID("a")))), FUN("p", {NUM(1), ID("a")})));
+        REQUIRE(!match(bindVars(fun("p", var("X"), val(ID("a")))), FUN("p", {NUM(1), ID("b")})));
+        REQUIRE(!match(bindVars(fun("p", var("X"), val(ID("a")))), FUN("q", {NUM(1), ID("a")})));
+        REQUIRE(!match(bindVars(fun("p", var("X"), val(ID("a")))), FUN("p", {NUM(1), ID("a")}).flipSign()));
+        REQUIRE(!match(bindVars(fun("p", var("X"))), FUN("p", {NUM(1), ID("a")})));
+        REQUIRE(!match(bindVars(fun("p", var("X"))), ID("p")));
+        REQUIRE(!match(bindVars(fun("p", var("X"))), NUM(1)));
+        REQUIRE(match(bindVars(fun("p", var("X"), var("X"))), FUN("p", {NUM(1), NUM(1)})));
+        REQUIRE(!match(bindVars(fun("p", var("X"), var("X"))), FUN("p", {NUM(1), NUM(2)})));
+        REQUIRE(match(bindVars(fun("p", fun("f", var("X")))), FUN("p", {FUN("f", {NUM(1)})})));
+
+        bool undefined = false;
+        UTerm x = bindVars(fun("p", var("X"), var("Y")));
+        FlatMatcher m(*x);
+        REQUIRE(m.match(FUN("p", {NUM(1), NUM(2)})));
+        REQUIRE(FUN("p", {NUM(1), NUM(2)}) == x->eval(undefined, log));
+    }
+
     SECTION("theory") {
         Potassco::TheoryData td;
         Output::TheoryData data(td);
@@ -356,9 +356,9 @@ int lua_absindex(lua_State *L, int idx) {
 //     return lua_objlen(L, index);
 // }
 
-// size_t lua_rawlen(lua_State *L, int index) {
-//     return lua_objlen(L, index);
-// }
+size_t lua_rawlen(lua_State *L, int index) {
+    return lua_objlen(L, index);
+}
 
 #endif
 
@@ -1185,6 +1185,84 @@ bool luacall(lua_State *L, clingo_location_t const *location, int context, char
     return true;
 }
 
+struct LuaCallBatchArgs_ {
+    char const *name;
+    clingo_symbol_t const *arguments;
+    size_t size;
+    size_t arity;
+    clingo_symbol_callback_t symbol_callback;
+    void *data;
+    std::vector<clingo_symbol_t> *symbols;
+};
+
+int luacall_batch_(lua_State *L) {
+    auto &args = *static_cast<LuaCallBatchArgs_*>(lua_touserdata(L, 1));
+    lua_getglobal(L, args.name);
+    lua_createtable(L, numeric_cast<int>(args.size), 0);
+    for (size_t i = 0; i < args.size; ++i) {
+        lua_createtable(L, numeric_cast<int>(args.arity), 0);
+        for (size_t j = 0; j < args.arity; ++j) {
+            Term::new_(L, args.arguments[i * args.arity + j]);
+            lua_rawseti(L, -2, numeric_cast<int>(j + 1));
+        }
+        lua_rawseti(L, -2, numeric_cast<int>(i + 1));
+    }
+    lua_call(L, 1, 1);
+    luaL_checktype(L, -1, LUA_TTABLE);
+    // there has to be exactly one result per call
+    size_t results = lua_rawlen(L, -1);
+    if (results != args.size) {
+        return luaL_error(L, "%s returned %d results for %d calls", args.name, numeric_cast<int>(results), numeric_cast<int>(args.size));
+    }
+    for (size_t i = 0; i < args.size; ++i) {
+        args.symbols->clear();
+        lua_rawgeti(L, -1, numeric_cast<int>(i + 1));
+        if (lua_type(L, -1) == LUA_TTABLE) {
+            for (size_t j = 0, e = lua_rawlen(L, -1); j < e; ++j) {
+                lua_rawgeti(L, -1, numeric_cast<int>(j + 1));
+                args.symbols->emplace_back(luaToVal(L, -1));
+                lua_pop(L, 1);
+            }
+        }
+        else { args.symbols->emplace_back(luaToVal(L, -1)); }
+        lua_pop(L, 1);
+        handle_c_error(L, args.symbol_callback(args.symbols->data(), args.symbols->size(), args.data));
+    }
+    return 0;
+}
+
+bool luacall_batch(lua_State *L, clingo_location_t const *location, char const *name, clingo_symbol_t const *arguments, size_t size, size_t arity, clingo_symbol_callback_t symbol_callback, void *symbol_callback_data) {
+    if (!lua_checkstack(L, 3)) {
+        clingo_set_error(clingo_error_bad_alloc, "lua stack size exceeded");
+        return false;
+    }
+    std::vector<clingo_symbol_t> symbols;
+    LuaCallBatchArgs_ args{ name, arguments, size, arity, symbol_callback, symbol_callback_data, &symbols };
+    lua_pushcfunction(L, luaTraceback);   // +1
+    int err = lua_gettop(L);
+    lua_pushcfunction(L, luacall_batch_); // +1
+    lua_pushlightuserdata(L, &args);      // +1
+    auto ret = lua_pcall(L, 1, 0, -3);    // -2|-1
+    lua_remove(L, err);
+    if (ret != 0) {
+        std::string loc, desc;
+        try {
+            std::ostringstream oss;
+            oss << *location;
+            loc = oss.str();
+            desc = "error calling ";
+            desc += name;
+        }
+        catch (...) {
+            lua_pop(L, 1); // |-1
+            clingo_set_error(clingo_error_runtime, "error during error handling");
+            return false;
+        }
+        return handle_lua_error(L, loc.c_str(), desc.c_str(), ret);
+    }
+    return true;
+}
+
 // {{{1 wrap SymbolicAtom
 
 struct SymbolicAtom : Object<SymbolicAtom> {
@@ -1825,6 +1903,73 @@ luaL_Reg const SolveHandle::metaI[] = {
     {nullptr, nullptr}
 };
 
+// {{{1 wrap GroundHandle
+
+// The lua state in which @-functions of lua scripts are called (if any).
+lua_State *&scriptState() {
+    static lua_State *L = nullptr;
+    return L;
+}
+
+// NOTE: handles of synchronous grounding calls are null
+struct GroundHandle : Object<GroundHandle> {
+    clingo_ground_handle_t *handle;
+    GroundHandle(clingo_ground_handle_t *handle) : handle(handle) { }
+    static int gc(lua_State *L) {
+        return close_(L, *(GroundHandle*)lua_touserdata(L, 1));
+    }
+    static int close(lua_State *L) {
+        return close_(L, get_self(L));
+    }
+    static int close_(lua_State *L, GroundHandle &self) {
+        if (self.handle) {
+            auto h = self.handle;
+            self.handle = nullptr;
+            handle_c_error(L, clingo_ground_handle_close(h));
+        }
+        return 0;
+    }
+    static int get(lua_State *L) {
+        auto &self = get_self(L);
+        lua_pushboolean(L, !self.handle || call_c(L, clingo_ground_handle_get, self.handle));
+        return 1;
+    }
+    static int wait(lua_State *L) {
+        auto &self = get_self(L);
+        double timeout = luaL_optnumber(L, 2, -1);
+        bool ret = true;
+        if (self.handle) { clingo_ground_handle_wait(self.handle, timeout, &ret); }
+        lua_pushboolean(L, ret);
+        return 1;
+    }
+    static int cancel(lua_State *L) {
+        auto &self = get_self(L);
+        if (self.handle) { handle_c_error(L, clingo_ground_handle_cancel(self.handle)); }
+        return 0;
+    }
+    static int progress(lua_State *L) {
+        auto &self = get_self(L);
+        uint64_t ret = 0;
+        if (self.handle) { clingo_ground_handle_progress(self.handle, &ret); }
+        lua_pushnumber(L, static_cast<lua_Number>(ret));
+        return 1;
+    }
+    static luaL_Reg const meta[];
+    static constexpr char const *typeName = "clingo.GroundHandle";
+};
+
+constexpr char const *GroundHandle::typeName;
+
+luaL_Reg const GroundHandle::meta[] = {
+    {"__gc", gc},
+    {"close", close},
+    {"get", get},
+    {"wait", wait},
+    {"cancel", cancel},
+    {"progress", progress},
+    {nullptr, nullptr}
+};
+
 // {{{1 wrap Configuration
 
 struct Configuration : Object<Configuration> {
@@ -2879,6 +3024,31 @@ struct ControlWrap : Object<ControlWrap> {
         handle_c_error(L, clingo_control_ground(ctl, parts, cpp_parts->size(), context ? on_context : nullptr, context ? &ctx : nullptr));
         return 0;
     }
+    // NOTE: lua states must not be accessed concurrently,
+    //       so there is no context argument for asynchronous grounding;
+    //       for the same reason, grounding is synchronous if lua scripts
+    //       might provide @-functions
+    static int ground_async(lua_State *L) {
+        auto &ctl = get_self(L).ctl;
+        luaL_checktype(L, 2, LUA_TTABLE);
+        using symbol_vector = std::vector<symbol_wrapper>;
+        auto cpp_parts = AnyWrap::new_<std::vector<std::pair<std::string, symbol_vector>>>(L); // +1
+        luaToCpp(L, 2, *cpp_parts);
+        clingo_part_t *parts = static_cast<decltype(parts)>(lua_newuserdata(L, sizeof(*parts) * cpp_parts->size())); // +1
+        auto it = parts;
+        for (auto &part : *cpp_parts) {
+            *it++ = clingo_part_t {
+                part.first.c_str(),
+                reinterpret_cast<clingo_symbol_t*>(part.second.data()),
+                part.second.size()
+            };
+        }
+        clingo_ground_handle_t *handle = nullptr;
+        if (scriptState()) { handle_c_error(L, clingo_control_ground(ctl, parts, cpp_parts->size(), nullptr, nullptr)); }
+        else               { handle = call_c(L, clingo_control_ground_async, ctl, parts, cpp_parts->size(), nullptr, nullptr); }
+        lua_pop(L, 2); // -2
+        return GroundHandle::new_(L, handle);
+    }
     static int add(lua_State *L) {
         auto &self = get_self(L);
         char const *name = luaL_checkstring(L, 2);
@@ -2899,6 +3069,22 @@ struct ControlWrap : Object<ControlWrap> {
         lua_pop(L, 2); // -2
         return 0;
     }
+    static int add_facts(lua_State *L) {
+        auto &self = get_self(L);
+        char const *name = luaL_checkstring(L, 2);
+        luaL_checktype(L, 3, LUA_TTABLE);
+        size_t size = lua_rawlen(L, 3);
+        auto *facts = AnyWrap::new_<std::vector<symbol_wrapper>>(L); // +1
+        protect(L, [facts, size](){ facts->resize(size); });
+        for (size_t i = 0; i < size; ++i) {
+            lua_rawgeti(L, 3, numeric_cast<int>(i + 1)); // +1
+            luaToCpp(L, -1, (*facts)[i]);
+            lua_pop(L, 1); // -1
+        }
+        handle_c_error(L, clingo_control_add_facts(self.ctl, name, reinterpret_cast<clingo_symbol_t const *>(facts->data()), size));
+        lua_pop(L, 1); // -1
+        return 0;
+    }
     static int load(lua_State *L) {
         auto &self = get_self(L);
         char const *filename = luaL_checkstring(L, 2);
@@ -3169,7 +3355,9 @@ struct ControlWrap : Object<ControlWrap> {
 constexpr char const *ControlWrap::typeName;
 luaL_Reg ControlWrap::meta[] = {
     {"ground",  ground},
+    {"ground_async",  ground_async},
     {"add", add},
+    {"add_facts", add_facts},
     {"load", load},
     {"solve", solve},
     {"cleanup", cleanup},
@@ -3219,6 +3407,7 @@ int luaopen_clingo(lua_State* L) {
     Model::reg(L);
     SolveControl::reg(L);
     SolveHandle::reg(L);
+    GroundHandle::reg(L);
     ControlWrap::reg(L);
     Configuration::reg(L);
     SolveResult::reg(L);
@@ -3279,9 +3468,11 @@ struct LuaScriptC {
     bool self_init_;
     LuaScriptC(lua_State *L)
     : L(L)
-    , self_init_(false)
-    { }
+    , self_init_(false) {
+        if (L) { scriptState() = L; }
+    }
     ~LuaScriptC() {
+        if (L && scriptState() == L) { scriptState() = nullptr; }
         if (self_init_ && L) { lua_close(L); }
     }
     bool init() {
@@ -3291,6 +3482,7 @@ struct LuaScriptC {
             clingo_set_error(clingo_error_runtime, "could not initialize lua interpreter");
             return false;
         }
+        scriptState() = L;
         self_init_ = true;
         if (!lua_checkstack(L, 2)) {
             clingo_set_error(clingo_error_runtime, "lua stack size exceeded");
@@ -3346,6 +3538,27 @@ struct LuaScriptC {
         *ret = lua_type(self.L, -1) == LUA_TFUNCTION;
         return true;
     }
+    // functions are batchable if they are marked in the global table clingo_batch
+    static bool batchable(char const * name, bool *ret, void *data) {
+        auto &self = *static_cast<LuaScriptC*>(data);
+        *ret = false;
+        if (!self.L) { return true; }
+        if (!lua_checkstack(self.L, 2)) {
+            clingo_set_error(clingo_error_runtime, "lua stack size exceeded");
+            return false;
+        }
+        LuaClear lc(self.L);
+        lua_getglobal(self.L, "clingo_batch");
+        if (lua_type(self.L, -1) == LUA_TTABLE) {
+            lua_getfield(self.L, -1, name);
+            *ret = lua_toboolean(self.L, -1) != 0;
+        }
+        return true;
+    }
+    static bool call_batch(clingo_location_t const *loc, char const *name, clingo_symbol_t const *arguments, size_t size, size_t arity, clingo_symbol_callback_t symbol_callback, void *symbol_callback_data, void *data) {
+        auto &self = *static_cast<LuaScriptC*>(data);
+        return luacall_batch(self.L, loc, name, arguments, size, arity, symbol_callback, symbol_callback_data);
+    }
     static bool main(clingo_control_t *ctl, void *data) {
         auto &self = *static_cast<LuaScriptC*>(data);
         LuaClear lc(self.L);
@@ -3384,6 +3597,9 @@ extern "C" bool clingo_register_lua_(lua_State *L) {
             LuaScriptC::main,
             LuaScriptC::free,
             strip_lua(LUA_RELEASE),
+            nullptr,
+            LuaScriptC::batchable,
+            LuaScriptC::call_batch,
         };
         return clingo_register_script_(clingo_ast_script_type_lua, &script, new LuaScriptC(L));
     }
@@ -35,6 +35,7 @@
 #include <iostream>
 #include <sstream>
 #include <vector>
+#include <unordered_map>
 #include <memory>
 #include <forward_list>
 #ifdef _MSC_VER
@@ -1014,6 +1015,28 @@ END_PROTOCOL(sq_inplace_repeat, tp_as_sequence, PySequenceMethods) {{
     Get_sq_inplace_repeat<B>::value,
 }};
 
+// buffer protocol
+
+BEGIN_PROTOCOL(bf_getbuffer)
+    static int value(PyObject *self, Py_buffer *view, int flags) {
+        PY_TRY { return (reinterpret_cast<B*>(self)->bf_getbuffer(view, flags), 0); }
+        PY_CATCH(-1);
+    };
+NEXT_PROTOCOL(bf_getbuffer, bf_releasebuffer)
+    static void value(PyObject *self, Py_buffer *view) {
+        reinterpret_cast<B*>(self)->bf_releasebuffer(view);
+    };
+END_PROTOCOL(bf_releasebuffer, tp_as_buffer, PyBufferProcs) {{
+#if PY_MAJOR_VERSION < 3
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+#endif
+    Get_bf_getbuffer<B>::value,
+    Get_bf_releasebuffer<B>::value,
+}};
+
 } // namespace PythonDetail
 
 template <class T>
@@ -1111,8 +1134,12 @@ PyTypeObject ObjectBase<T>::type = {
     PythonDetail::Get_tp_str<T>::value,         // tp_str
     PythonDetail::Get_tp_getattro<T>::value,    // tp_getattro
     PythonDetail::Get_tp_setattro<T>::value,    // tp_setattro
-    nullptr,                                    // tp_as_buffer
+    PythonDetail::Get_tp_as_buffer<T>::value,   // tp_as_buffer
+#ifdef Py_TPFLAGS_HAVE_NEWBUFFER
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_NEWBUFFER, // tp_flags
+#else
     Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,   // tp_flags
+#endif
     T::tp_doc,                                  // tp_doc
     nullptr,                                    // tp_traverse
     nullptr,                                    // tp_clear
@@ -1732,6 +1759,173 @@ PyGetSetDef Symbol::tp_getset[] = {
 PyObject *Symbol::inf = nullptr;
 PyObject *Symbol::sup = nullptr;
 
+// {{{1 wrap SymbolArray
+
+struct SymbolArray : ObjectBase<SymbolArray> {
+    using SymbolVec = std::vector<clingo_symbol_t>;
+    SymbolVec symbols;
+    Py_ssize_t shape;
+    Py_ssize_t stride;
+    static PyMethodDef tp_methods[];
+    static PyGetSetDef tp_getset[];
+    static constexpr char const *tp_type = "SymbolArray";
+    static constexpr char const *tp_name = "clingo.SymbolArray";
+    static constexpr char const *tp_doc =
+R"(A read-only sequence of symbols stored in one contiguous buffer.
+
+Symbol objects are only created when elements are accessed. The array
+implements the buffer protocol exposing the raw symbol representations as
+unsigned 64 bit integers, and provides accessors that extract a property of all
+symbols in one call.
+
+Note that SymbolArray objects cannot be constructed from python. Instead they
+are returned by Model.symbols() and SymbolicAtoms.export_atoms().
+
+Example:
+
+#script (python)
+
+def main(prg):
+    prg.ground([("base", [])])
+    with prg.solve(yield_=True) as handle:
+        for m in handle:
+            syms = m.symbols(atoms=True, array=True)
+            print len(syms), syms.names, syms.argument(0).numbers
+
+#end.
+
+p(1). p(2).
+
+Expected Output:
+
+2 ['p', 'p'] [1, 2])";
+
+    static Object construct(SymbolVec &&syms) {
+        auto self = new_();
+        new (&self->symbols) SymbolVec(std::move(syms));
+        return self;
+    }
+
+    void tp_dealloc() {
+        symbols.~SymbolVec();
+    }
+
+    Py_ssize_t sq_length() {
+        return symbols.size();
+    }
+
+    Object sq_item(Py_ssize_t index) {
+        if (index < 0 || index >= sq_length()) {
+            PyErr_Format(PyExc_IndexError, "invalid index");
+            return nullptr;
+        }
+        return Symbol::construct(symbols[index]);
+    }
+
+    void bf_getbuffer(Py_buffer *view, int flags) {
+        view->obj = nullptr;
+        if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+            PyErr_SetString(PyExc_BufferError, "symbol arrays are read-only");
+            throw PyException();
+        }
+        shape  = symbols.size();
+        stride = sizeof(clingo_symbol_t);
+        view->buf        = symbols.data();
+        view->len        = shape * stride;
+        view->itemsize   = stride;
+        view->readonly   = 1;
+        view->format     = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? const_cast<char*>("Q") : nullptr;
+        view->ndim       = 1;
+        view->shape      = (flags & PyBUF_ND) == PyBUF_ND ? &shape : nullptr;
+        view->strides    = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &stride : nullptr;
+        view->suboffsets = nullptr;
+        view->internal   = nullptr;
+        view->obj        = toPy();
+        Py_INCREF(view->obj);
+    }
+
+    template <class F>
+    Object column(F f) {
+        List ret;
+        for (auto &sym : symbols) { ret.append(f(sym)); }
+        return ret;
+    }
+
+    Object names() {
+        // NOTE: names are interned, so equal names share one string object
+        std::unordered_map<char const *, Object> cache;
+        return column([&cache](clingo_symbol_t sym) -> Object {
+            if (clingo_symbol_type(sym) != clingo_symbol_type_function) { return None(); }
+            char const *name;
+            handle_c_error(clingo_symbol_name(sym, &name));
+            auto it = cache.find(name);
+            if (it == cache.end()) { it = cache.emplace(name, cppToPy(name)).first; }
+            return it->second;
+        });
+    }
+
+    Object strings() {
+        return column([](clingo_symbol_t sym) -> Object {
+            if (clingo_symbol_type(sym) != clingo_symbol_type_string) { return None(); }
+            char const *str;
+            handle_c_error(clingo_symbol_string(sym, &str));
+            return cppToPy(str);
+        });
+    }
+
+    Object numbers() {
+        return column([](clingo_symbol_t sym) -> Object {
+            if (clingo_symbol_type(sym) != clingo_symbol_type_number) { return None(); }
+            int num;
+            handle_c_error(clingo_symbol_number(sym, &num));
+            return cppToPy(num);
+        });
+    }
+
+    Object argument(Reference pyIndex) {
+        auto index = pyToCpp<size_t>(pyIndex);
+        SymbolVec ret;
+        ret.reserve(symbols.size());
+        for (auto &sym : symbols) {
+            clingo_symbol_t const *args = nullptr;
+            size_t size = 0;
+            if (clingo_symbol_type(sym) == clingo_symbol_type_function) {
+                handle_c_error(clingo_symbol_arguments(sym, &args, &size));
+            }
+            if (index >= size) {
+                PyErr_Format(PyExc_IndexError, "symbol has no argument with index %zu", index);
+                throw PyException();
+            }
+            ret.emplace_back(args[index]);
+        }
+        return construct(std::move(ret));
+    }
+};
+
+PyMethodDef SymbolArray::tp_methods[] = {
+    {"argument", to_function<&SymbolArray::argument>(), METH_O,
+R"(argument(self, index) -> SymbolArray
+
+Return the array of the index-th arguments of all symbols.
+
+All symbols in the array have to be functions with more than index arguments.
+)"},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyGetSetDef SymbolArray::tp_getset[] = {
+    {(char *)"names", to_getter<&SymbolArray::names>(), nullptr, (char *)
+R"(The list of the names of all symbols (None for symbols that are not
+functions).)", nullptr},
+    {(char *)"strings", to_getter<&SymbolArray::strings>(), nullptr, (char *)
+R"(The list of the values of all symbols (None for symbols that are not
+strings).)", nullptr},
+    {(char *)"numbers", to_getter<&SymbolArray::numbers>(), nullptr, (char *)
+R"(The list of the values of all symbols (None for symbols that are not
+numbers).)", nullptr},
+    {nullptr, nullptr, nullptr, nullptr, nullptr}
+};
+
 // {{{1 wrap SolveResult
 
 struct SolveResult : ObjectBase<SolveResult> {
@@ -2015,6 +2209,28 @@ signatures: [('p', 1), ('q', 1)])";
         return SymbolicAtomIter::construct(atoms, ret);
     }
 
+    Object exportAtoms(Reference pyargs, Reference pykwds) {
+        PyObject *pyname = Py_None;
+        int arity = 0;
+        PyObject *pos = Py_True;
+        char const *kwlist[] = {"name", "arity", "positive"};
+        ParseTupleAndKeywords(pyargs, pykwds, "|OiO", kwlist, pyname, arity, pos);
+        clingo_signature_t sig;
+        clingo_signature_t const *psig = nullptr;
+        if (pyname != Py_None) {
+            auto name = pyToCpp<std::string>(pyname);
+            handle_c_error(clingo_signature_create(name.c_str(), arity, pyToCpp<bool>(pos), &sig));
+            psig = &sig;
+        }
+        size_t size;
+        handle_c_error(clingo_symbolic_atoms_export_size(atoms, psig, &size));
+        std::vector<clingo_symbol_t> symbols(size);
+        std::vector<clingo_literal_t> literals(size);
+        std::vector<clingo_symbolic_atom_flags_t> flags(size);
+        handle_c_error(clingo_symbolic_atoms_export(atoms, psig, symbols.data(), literals.data(), flags.data(), size));
+        return Tuple{SymbolArray::construct(std::move(symbols)), cppRngToPy(literals.begin(), literals.end()), cppRngToPy(flags.begin(), flags.end())};
+    }
+
     Object signatures() {
         size_t size;
         handle_c_error(clingo_symbolic_atoms_signatures_size(atoms, &size));
@@ -2042,6 +2258,39 @@ Arguments:
 name     -- the name of the signature
 arity    -- the arity of the signature
 positive -- the sign of the signature
+)"},
+    {"export_atoms", to_function<&SymbolicAtoms::exportAtoms>(), METH_KEYWORDS | METH_VARARGS,
+R"(export_atoms(self, name, arity, positive) -> (SymbolArray, list[int], list[int])
+
+Return the symbols, program literals, and flags of all symbolic atoms in one
+call.
+
+If a name is given, only atoms with the given signature are exported. The
+atoms are listed in the same order as when iterating over the symbolic atoms.
+In the flags, bit 1 is set for facts and bit 2 for externals.
+
+Arguments:
+name     -- the name of the signature (default: None)
+arity    -- the arity of the signature (default: 0)
+positive -- the sign of the signature (default: True)
+
+Example:
+
+#script (python)
+
+def main(prg):
+    prg.ground([("base", [])])
+    symbols, literals, flags = prg.symbolic_atoms.export_atoms("p", 1)
+    print list(symbols), flags
+
+#end.
+
+p(1).
+{ p(2) }.
+
+Expected Output:
+
+[p(1), p(2)] [1, 0]
 )"},
     {nullptr, nullptr, 0, nullptr}
 };
@@ -2213,9 +2462,9 @@ places like - e.g., the main function.)";
     }
     Object atoms(Reference pyargs, Reference pykwds) {
         clingo_show_type_bitset_t atomset = 0;
-        static char const *kwlist[] = {"atoms", "terms", "shown", "csp", "extra", "complement", nullptr};
-        Reference pyAtoms = Py_False, pyTerms = Py_False, pyShown = Py_False, pyCSP = Py_False, pyExtra = Py_False, pyComp = Py_False;
-        ParseTupleAndKeywords(pyargs, pykwds, "|OOOOOO", const_cast<char**>(kwlist), pyAtoms, pyTerms, pyShown, pyCSP, pyExtra, pyComp);
+        static char const *kwlist[] = {"atoms", "terms", "shown", "csp", "extra", "complement", "array", nullptr};
+        Reference pyAtoms = Py_False, pyTerms = Py_False, pyShown = Py_False, pyCSP = Py_False, pyExtra = Py_False, pyComp = Py_False, pyArray = Py_False;
+        ParseTupleAndKeywords(pyargs, pykwds, "|OOOOOOO", const_cast<char**>(kwlist), pyAtoms, pyTerms, pyShown, pyCSP, pyExtra, pyComp, pyArray);
         if (pyToCpp<bool>(pyAtoms)) { atomset |= clingo_show_type_atoms; }
         if (pyToCpp<bool>(pyTerms)) { atomset |= clingo_show_type_terms; }
         if (pyToCpp<bool>(pyShown)) { atomset |= clingo_show_type_shown; }
@@ -2224,6 +2473,11 @@ places like - e.g., the main function.)";
         if (pyToCpp<bool>(pyComp))  { atomset |= clingo_show_type_complement; }
         size_t size;
         handle_c_error(clingo_model_symbols_size(model, atomset, &size));
+        if (pyToCpp<bool>(pyArray)) {
+            SymbolArray::SymbolVec ret(size);
+            handle_c_error(clingo_model_symbols(model, atomset, ret.data(), size));
+            return SymbolArray::construct(std::move(ret));
+        }
         std::vector<symbol_wrapper> ret(size);
         auto fst = reinterpret_cast<clingo_symbol_t*>(ret.data());
         handle_c_error(clingo_model_symbols(model, atomset, fst, size));
@@ -2316,7 +2570,7 @@ The return values correspond to clasp's cost output.)", nullptr},
 
 PyMethodDef Model::tp_methods[] = {
     {"symbols", to_function<&Model::atoms>(), METH_VARARGS | METH_KEYWORDS,
-R"(symbols(self, atoms, terms, shown, csp, extra, complement)
+R"(symbols(self, atoms, terms, shown, csp, extra, complement, array)
         -> list of terms
 
 Return the list of atoms, terms, or CSP assignments in the model.
@@ -2335,6 +2589,8 @@ extra      -- select terms added by clingo extensions
 complement -- return the complement of the answer set w.r.t. to the Herbrand
               base accumulated so far (does not affect csp assignments)
               (Default: False)
+array      -- return a SymbolArray instead of a list
+              (Default: False)
 
 Note that atoms are represented using functions (Symbol objects), and that CSP
 assignments are represented using functions with name "$" where the first
@@ -2558,6 +2814,109 @@ search.)"},
     {nullptr, nullptr, 0, nullptr}
 };
 
+// {{{1 wrap GroundHandle
+
+struct GroundHandle : ObjectBase<GroundHandle> {
+    clingo_ground_handle_t *handle;
+    PyObject *context;
+    PyObject *control;
+
+    static PyMethodDef tp_methods[];
+    static constexpr char const *tp_type = "GroundHandle";
+    static constexpr char const *tp_name = "clingo.GroundHandle";
+    static constexpr char const *tp_doc =
+R"(Handle for asynchronous ground calls.
+
+GroundHandle objects cannot be created from python. Instead they are returned
+by Control.ground if grounding is started asynchronously.  A GroundHandle
+object can be used to wait for, poll the progress of, or cancel grounding.
+
+Blocking functions in this object release the GIL. They are not thread-safe
+though.)";
+
+    static SharedObject<GroundHandle> construct(Reference control, Reference context) {
+        auto self = new_();
+        self->handle = nullptr;
+        self->context = context.none() ? nullptr : context.toPy();
+        self->control = control.toPy();
+        Py_XINCREF(self->context);
+        Py_INCREF(self->control);
+        return self;
+    }
+
+    void tp_dealloc() {
+        if (handle) {
+            auto h = handle;
+            handle = nullptr;
+            doUnblocked([h](){ handle_c_error(clingo_ground_handle_close(h)); });
+        }
+        Py_XDECREF(context);
+        Py_XDECREF(control);
+    }
+
+    Object get() {
+        return cppToPy(doUnblocked([this]() {
+            bool completed;
+            handle_c_error(clingo_ground_handle_get(handle, &completed));
+            return completed;
+        }));
+    }
+
+    Object wait(Reference args) {
+        Reference timeout = Py_None;
+        ParseTuple(args, "|O", timeout);
+        auto time = timeout.none() ? -1 : pyToCpp<double>(timeout);
+        return cppToPy(doUnblocked([this, time](){
+            bool ret;
+            clingo_ground_handle_wait(handle, time, &ret);
+            return ret;
+        }));
+    }
+
+    Object cancel() {
+        doUnblocked([this](){ handle_c_error(clingo_ground_handle_cancel(handle)); });
+        Py_RETURN_NONE;
+    }
+
+    Object progress() {
+        uint64_t ret;
+        clingo_ground_handle_progress(handle, &ret);
+        return cppToPy(ret);
+    }
+};
+
+PyMethodDef GroundHandle::tp_methods[] = {
+    {"get", to_function<&GroundHandle::get>(), METH_NOARGS,
+R"(get(self) -> bool
+
+Wait for grounding to finish and return whether it completed without being
+cancelled.
+
+Errors raised while grounding are reraised by this function.)"},
+    {"wait", to_function<&GroundHandle::wait>(),  METH_VARARGS,
+R"(wait(self, timeout) -> bool
+
+Wait for grounding to finish with an optional timeout.
+
+If a timeout is given, the function waits at most timeout seconds. The
+function returns a Boolean indicating whether grounding has finished.
+
+Arguments:
+timeout -- optional timeout in seconds
+           (permits floating point values))"},
+    {"cancel", to_function<&GroundHandle::cancel>(), METH_NOARGS,
+R"(cancel(self) -> None
+
+Stop grounding at the next cancellation point and wait until it stopped.
+
+The current step is finished with the rules grounded so far.)"},
+    {"progress", to_function<&GroundHandle::progress>(), METH_NOARGS,
+R"(progress(self) -> int
+
+Return the number of rule instances grounded so far.)"},
+    {nullptr, nullptr, 0, nullptr}
+};
+
 // {{{1 wrap Configuration
 
 struct Configuration : ObjectBase<Configuration> {
@@ -5595,6 +5954,23 @@ active; you must not call any member function during search.)";
         handle_c_error(clingo_control_add(ctl, name, params.data(), params.size(), part));
         Py_RETURN_NONE;
     }
+    Object addFacts(Reference args) {
+        CHECK_BLOCKED("add_facts");
+        char *name;
+        Reference pyFacts;
+        ParseTuple(args, "sO", name, pyFacts);
+        Object pySeq{PySequence_Fast(pyFacts.toPy(), "sequence of symbols expected")};
+        auto size = PySequence_Fast_GET_SIZE(pySeq.toPy());
+        auto items = PySequence_Fast_ITEMS(pySeq.toPy());
+        symbol_vector facts;
+        facts.reserve(size);
+        for (auto it = items, ie = items + size; it != ie; ++it) {
+            facts.emplace_back();
+            pyToCpp(*it, facts.back());
+        }
+        handle_c_error(clingo_control_add_facts(ctl, name, reinterpret_cast<clingo_symbol_t const *>(facts.data()), facts.size()));
+        Py_RETURN_NONE;
+    }
     Object load(Reference args) {
         CHECK_BLOCKED("load");
         char *filename;
@@ -5603,6 +5979,7 @@ active; you must not call any member function during search.)";
         Py_RETURN_NONE;
     }
     static bool on_context(clingo_location_t const *location, char const *name, clingo_symbol_t const *arguments, size_t arguments_size, void *data, clingo_symbol_callback_t symbol_callback, void *symbol_callback_data) {
+        PyBlock block;
         try {
             Object fun = PyObject_GetAttrString(static_cast<PyObject*>(data), name);
             pycall(fun.toPy(), arguments, arguments_size, symbol_callback, symbol_callback_data);
@@ -5615,18 +5992,23 @@ active; you must not call any member function during search.)";
     }
     Object ground(Reference args, Reference kwds) {
         CHECK_BLOCKED("ground");
-        static char const *kwlist[] = {"parts", "context", nullptr};
+        static char const *kwlist[] = {"parts", "context", "async", nullptr};
         Reference pyParts = Py_None;
         Reference pyContext = Py_None;
-        ParseTupleAndKeywords(args, kwds, "O|O", kwlist, pyParts, pyContext);
+        Reference pyAsync = Py_False;
+        ParseTupleAndKeywords(args, kwds, "O|OO", kwlist, pyParts, pyContext, pyAsync);
         std::vector<std::pair<std::string, symbol_vector>> cpp_parts;
         std::vector<clingo_part_t> parts;
         pyToCpp(pyParts, cpp_parts);
         for (auto &&cpp_part : cpp_parts) {
             parts.emplace_back(clingo_part_t{cpp_part.first.c_str(), reinterpret_cast<clingo_symbol_t*>(cpp_part.second.data()), cpp_part.second.size()});
         }
-        // TODO: consider unblocking this one (the callbacks have to be blocked again for this to work)
-        handle_c_error(clingo_control_ground(ctl, parts.data(), parts.size(), pyContext.none() ? nullptr : on_context, pyContext.none() ? nullptr : pyContext.toPy()));
+        if (pyAsync.isTrue()) {
+            auto handle = GroundHandle::construct(Reference{reinterpret_cast<PyObject*>(this)}, pyContext);
+            doUnblocked([&](){ handle_c_error(clingo_control_ground_async(ctl, parts.data(), parts.size(), handle->context ? on_context : nullptr, handle->context, &handle->handle)); });
+            return handle;
+        }
+        doUnblocked([&](){ handle_c_error(clingo_control_ground(ctl, parts.data(), parts.size(), pyContext.none() ? nullptr : on_context, pyContext.none() ? nullptr : pyContext.toPy())); });
         Py_RETURN_NONE;
     }
     Object getConst(Reference args) {
@@ -5808,7 +6190,7 @@ def main(prg):
 )"},
     // ground
     {"ground", to_function<&ControlWrap::ground>(), METH_KEYWORDS | METH_VARARGS,
-R"(ground(self, parts, context) -> None
+R"(ground(self, parts, context, async) -> None or GroundHandle
 
 Ground the given list of program parts specified by tuples of names and arguments.
 
@@ -5816,6 +6198,22 @@ Keyword Arguments:
 parts   -- list of tuples of program names and program arguments to ground
 context -- context object whose methods are called during grounding using
            the @-syntax (if ommitted methods from the main module are used)
+async   -- ground in the background and return a GroundHandle (default: False)
+
+If grounding is started asynchronously, other methods of the control object
+raise a RuntimeError until it has finished. The handle keeps the control object
+alive while grounding.
+
+The global interpreter lock is released while grounding. It is only
+reacquired to call context methods, scripts, and observers. This way,
+multiple control objects can ground concurrently from different threads.
+
+Results of functions defined in embedded scripts are memoized if the function
+has an attribute pure set to True, e.g., after assigning f.pure = True. Such a
+function must only depend on its arguments. Similarly, a function with an
+attribute batch set to True is called once with a list of argument tuples
+collected from many rule instances; it has to return a list holding one result
+per tuple. Methods of the context object are never memoized or batched.
 
 Note that parts of a logic program without an explicit #program specification
 are by default put into a program called base without arguments.
@@ -5869,6 +6267,34 @@ def main(prg):
 
 Expected Answer Set:
 q(2))"},
+    // add_facts
+    {"add_facts", to_function<&ControlWrap::addFacts>(), METH_VARARGS,
+R"(add_facts(self, name, facts) -> None
+
+Extend the logic program with the given facts.
+
+The facts are added to the program block with the given name and no
+parameters. Unlike facts in programs passed to Control.add, they are neither
+parsed nor subject to constant definitions.
+
+Arguments:
+name  -- name of program block to add the facts to
+facts -- sequence of symbols
+
+Example:
+
+#script (python)
+import clingo
+
+def main(prg):
+    prg.add_facts("base", [clingo.Function("p", [i]) for i in range(3)])
+    prg.ground([("base", [])])
+    prg.solve()
+
+#end.
+
+Expected Answer Set:
+p(0) p(1) p(2))"},
     // load
     {"load", to_function<&ControlWrap::load>(), METH_VARARGS,
 R"(load(self, path) -> None
@@ -6870,6 +7296,7 @@ PyObject *initclingo_() {
             !SolveResult::initType(m)         || !TheoryTermType::initType(m)   || !PropagateControl::initType(m) ||
             !TheoryElement::initType(m)       || !TheoryAtom::initType(m)       || !TheoryAtomIter::initType(m)   ||
             !Model::initType(m)               || !ModelType::initType(m)        || !SolveHandle::initType(m)      ||
+            !GroundHandle::initType(m)        || !SymbolArray::initType(m)      ||
             !ControlWrap::initType(m)         || !Configuration::initType(m)    || !SolveControl::initType(m)     ||
             !SymbolicAtom::initType(m)        || !SymbolicAtomIter::initType(m) || !SymbolicAtoms::initType(m)    ||
             !TheoryTerm::initType(m)          || !PropagateInit::initType(m)    || !Assignment::initType(m)       ||
@@ -6990,6 +7417,51 @@ public:
         Object fun = PyMapping_GetItemString(main, const_cast<char *>(name));
         return PyCallable_Check(fun.toPy());
     }
+    bool pure(char const *name) {
+        if (!PyMapping_HasKeyString(main, const_cast<char *>(name))) { return false; }
+        Object fun = PyMapping_GetItemString(main, const_cast<char *>(name));
+        if (!PyObject_HasAttrString(fun.toPy(), "pure")) { return false; }
+        Object pure = PyObject_GetAttrString(fun.toPy(), "pure");
+        return pure.isTrue();
+    }
+    bool batchable(char const *name) {
+        if (!PyMapping_HasKeyString(main, const_cast<char *>(name))) { return false; }
+        Object fun = PyMapping_GetItemString(main, const_cast<char *>(name));
+        if (!PyObject_HasAttrString(fun.toPy(), "batch")) { return false; }
+        Object batch = PyObject_GetAttrString(fun.toPy(), "batch");
+        return batch.isTrue();
+    }
+    void callBatch(char const *name, clingo_symbol_t const *arguments, size_t size, size_t arity, clingo_symbol_callback_t symbol_callback, void *data) {
+        Object fun = PyMapping_GetItemString(main, const_cast<char*>(name));
+        Object tuples = PyList_New(size);
+        for (size_t i = 0; i < size; ++i) {
+            Object tuple = PyTuple_New(arity);
+            for (size_t j = 0; j < arity; ++j) {
+                PyTuple_SET_ITEM(tuple.toPy(), j, Symbol::construct(arguments[i * arity + j]).release());
+            }
+            PyList_SET_ITEM(tuples.toPy(), i, tuple.release());
+        }
+        Object params = PyTuple_New(1);
+        if (PyTuple_SetItem(params.toPy(), 0, tuples.release()) < 0) { throw PyException(); }
+        Object ret = PyObject_Call(fun.toPy(), params.toPy(), Py_None);
+        std::vector<clingo_symbol_t> symbols;
+        size_t results = 0;
+        for (auto &&res : ret.iter()) {
+            symbols.clear();
+            auto add = [&](Reference sym) {
+                symbol_wrapper val;
+                pyToCpp(sym, val);
+                symbols.emplace_back(val.symbol);
+            };
+            if (PyList_Check(res.toPy())) {
+                for (auto &&x : res.iter()) { add(x); }
+            }
+            else { add(res); }
+            handle_c_error(symbol_callback(symbols.data(), symbols.size(), data));
+            ++results;
+        }
+        if (results != size) { throw std::runtime_error("batch function must return one result per argument tuple"); }
+    }
     void call(char const *name, clingo_symbol_t const *arguments, size_t size, clingo_symbol_callback_t symbol_callback, void *data) {
         Object fun = PyMapping_GetItemString(main, const_cast<char*>(name));
         pycall(fun, arguments, size, symbol_callback, data);
@@ -7019,6 +7491,7 @@ struct PythonScript {
         }
     }
     static bool call(clingo_location_t const *loc, char const *name, clingo_symbol_t const *arguments, size_t size, clingo_symbol_callback_t symbol_callback, void *symbol_callback_data, void *) {
+        PyBlock block;
         try {
             if (!impl) { impl.reset(new PythonImpl()); }
             impl->call(name, arguments, size, symbol_callback, symbol_callback_data);
@@ -7030,6 +7503,7 @@ struct PythonScript {
         }
     }
     static bool callable(char const * name, bool *ret, void *) {
+        PyBlock block;
         try {
             *ret = impl && impl->callable(name);
             return true;
@@ -7039,6 +7513,40 @@ struct PythonScript {
             return false;
         }
     }
+    static bool pure(char const * name, bool *ret, void *) {
+        PyBlock block;
+        try {
+            *ret = impl && impl->pure(name);
+            return true;
+        }
+        catch (...) {
+            handle_cxx_error("<python>", "error checking if function is pure");
+            return false;
+        }
+    }
+    static bool batchable(char const * name, bool *ret, void *) {
+        PyBlock block;
+        try {
+            *ret = impl && impl->batchable(name);
+            return true;
+        }
+        catch (...) {
+            handle_cxx_error("<python>", "error checking if function is batchable");
+            return false;
+        }
+    }
+    static bool call_batch(clingo_location_t const *loc, char const *name, clingo_symbol_t const *arguments, size_t size, size_t arity, clingo_symbol_callback_t symbol_callback, void *symbol_callback_data, void *) {
+        PyBlock block;
+        try {
+            if (!impl) { impl.reset(new PythonImpl()); }
+            impl->callBatch(name, arguments, size, arity, symbol_callback, symbol_callback_data);
+            return true;
+        }
+        catch (...) {
+            handle_cxx_error(*loc, "error calling python function");
+            return false;
+        }
+    }
     static bool main(clingo_control_t *ctl, void *) {
         try {
             if (!impl) { impl.reset(new PythonImpl()); }
@@ -7076,7 +7584,10 @@ extern "C" bool clingo_register_python_() {
             PythonScript::callable,
             PythonScript::main,
             PythonScript::free,
-            PY_VERSION
+            PY_VERSION,
+            PythonScript::pure,
+            PythonScript::batchable,
+            PythonScript::call_batch
         };
         return clingo_register_script_(clingo_ast_script_type_python, &script, nullptr);
     }
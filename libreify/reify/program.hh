@@ -27,9 +27,9 @@
 
 #include <reify/util.hh>
 #include <vector>
+#include <memory>
 #include <unordered_map>
 #include <cstdint>
-#include <gringo/graph.hh>
 #include <potassco/aspif.h>
 
 namespace Reify {
@@ -48,9 +48,97 @@ using Potassco::AtomSpan;
 using Potassco::WeightLitSpan;
 using Potassco::StringSpan;
 
+//! Receives the facts produced by the Reifier.
+//!
+//! The arguments of a fact are passed in order between beginFact() and
+//! endFact(). Arguments that are functions themselves are enclosed by
+//! beginFunction() and endFunction().
+class FactSink {
+public:
+    virtual void beginFact(char const *name) = 0;
+    virtual void beginFunction(char const *name) = 0;
+    virtual void endFunction() = 0;
+    virtual void number(int num) = 0;
+    virtual void identifier(char const *name) = 0;
+    //! A string constant given by its unquoted content.
+    virtual void string(StringSpan const &str) = 0;
+    //! A term given in textual form, e.g., the term of an output statement.
+    virtual void term(StringSpan const &str) = 0;
+    virtual void endFact() = 0;
+    virtual ~FactSink() noexcept;
+};
+
+//! Prints facts in text form.
+class StreamSink : public FactSink {
+public:
+    StreamSink(std::ostream &out);
+
+    void beginFact(char const *name) override;
+    void beginFunction(char const *name) override;
+    void endFunction() override;
+    void number(int num) override;
+    void identifier(char const *name) override;
+    void string(StringSpan const &str) override;
+    void term(StringSpan const &str) override;
+    void endFact() override;
+
+private:
+    void separate();
+
+    std::ostream &out_;
+    bool sep_ = false;
+};
+
+// Maintains the strongly connected components of a growing graph.
+//
+// Because edges are only ever added, components can only merge. They are
+// kept in a union-find structure, and an update runs Tarjan's algorithm on
+// the condensed graph starting from the sources of the edges added since
+// the last update. Parts of the graph not reachable from new edges are not
+// traversed again.
+class SCCGraph {
+public:
+    using SCCVec = std::vector<std::vector<Atom_t>>;
+
+    void addEdge(Atom_t u, Atom_t v);
+    // Returns the components with more than one atom formed since the last
+    // update; atoms are sorted.
+    SCCVec update();
+
+private:
+    uint32_t addNode(Atom_t atom);
+    uint32_t find(uint32_t node);
+    void visit(uint32_t node);
+
+    struct Frame {
+        uint32_t rep;
+        uint32_t member;
+        uint32_t edge;
+    };
+
+    std::unordered_map<Atom_t, uint32_t> nodes_;
+    std::vector<Atom_t> atoms_;
+    std::vector<std::vector<uint32_t>> edges_;
+    // union-find forest and circular lists of the nodes in a component
+    std::vector<uint32_t> parent_;
+    std::vector<uint32_t> next_;
+    std::vector<uint32_t> sources_;
+    std::vector<bool> source_;
+    // state of Tarjan's algorithm; valid if visited_ equals stamp_
+    std::vector<uint32_t> index_;
+    std::vector<uint32_t> lowlink_;
+    std::vector<uint32_t> visited_;
+    std::vector<bool> onStack_;
+    std::vector<uint32_t> stack_;
+    std::vector<Frame> frames_;
+    uint32_t stamp_ = 0;
+    uint32_t count_ = 0;
+};
+
 class Reifier : public Potassco::AbstractProgram {
 public:
     Reifier(std::ostream &out, bool calculateSCCs, bool reifyStep);
+    Reifier(FactSink &sink, bool calculateSCCs, bool reifyStep);
     virtual ~Reifier() noexcept;
 
     void parse(std::istream &in);
@@ -77,40 +165,36 @@ public:
     void endStep() override;
 
 private:
-    using Graph = Gringo::Graph<Atom_t>;
     template <class L>
     void calculateSCCs(const AtomSpan& head, const Potassco::Span<L>& body);
     template<typename... T>
     void printFact(char const *name, T const &...args);
     template<typename... T>
     void printStepFact(char const *name, T const &...args);
-    template <class M, class T>
-    size_t tuple(M &map, char const *name, T const &args);
-    template <class M, class T>
-    size_t tuple(M &map, char const *name, std::vector<T> &&args);
-    template <class M, class T>
-    size_t ordered_tuple(M &map, char const *name, T const &args);
-    template <class M, class T>
-    size_t ordered_tuple(M &map, char const *name, std::vector<T> &&args);
+    template <class T>
+    size_t tuple(TupleMap<T> &map, char const *name, Potassco::Span<T> const &args);
+    template <class T>
+    size_t ordered_tuple(TupleMap<T> &map, char const *name, Potassco::Span<T> const &args);
     size_t theoryTuple(IdSpan const &args);
     size_t litTuple(LitSpan const &args);
     size_t atomTuple(AtomSpan const &args);
     size_t theoryElementTuple(IdSpan const &args);
     size_t weightLitTuple(WeightLitSpan const &args);
-    Graph::Node &addNode(Atom_t atom);
 
 private:
     using WLVec = std::vector<std::pair<Lit_t, Weight_t>>;
     struct StepData {
-        std::unordered_map<std::vector<Id_t>, size_t, Hash<std::vector<Id_t>>> theoryTuples;
-        std::unordered_map<std::vector<Id_t>, size_t, Hash<std::vector<Id_t>>> theoryElementTuples;
-        std::unordered_map<std::vector<Lit_t>, size_t, Hash<std::vector<Lit_t>>> litTuples;
-        std::unordered_map<std::vector<Atom_t>, size_t, Hash<std::vector<Atom_t>>> atomTuples;
-        std::unordered_map<WLVec, size_t, Hash<WLVec>> weightLitTuples;
-        Graph graph_;
-        std::unordered_map<Atom_t, Graph::Node*> nodes_;
+        TupleMap<Id_t> theoryTuples;
+        TupleMap<Id_t> theoryElementTuples;
+        TupleMap<Lit_t> litTuples;
+        TupleMap<Atom_t> atomTuples;
+        TupleMap<WLVec::value_type> weightLitTuples;
+        SCCGraph graph_;
+        size_t sccs_ = 0;
     } stepData_;
-    std::ostream &out_;
+    WLVec wlits_;
+    std::unique_ptr<FactSink> stream_;
+    FactSink &sink_;
     size_t step_ = 0;
     bool calculateSCCs_;
     bool reifyStep_;
@@ -29,6 +29,7 @@
 #include <memory>
 #include <functional>
 #include <vector>
+#include <algorithm>
 #include <iostream>
 #include <potassco/basic_types.h>
 
@@ -70,18 +71,6 @@ void printValue(std::ostream &out, std::pair<T, U> const &value) {
     printValue(out, value.second);
 }
 
-template<typename T>
-void printComma(std::ostream &out, T const &t) {
-    printValue(out, t);
-}
-
-template<typename T, typename U, typename... V>
-void printComma(std::ostream &out, T const &t, U const &u, V const &...v) {
-    printValue(out, t);
-    out << ",";
-    printComma(out, u, v...);
-}
-
 template<typename T>
 struct Hash : std::hash<T> { };
 
@@ -110,6 +99,66 @@ std::vector<T> toVec(Potassco::Span<T> span) {
     return {span.first, span.first + span.size};
 }
 
+// Maps tuples to consecutive ids.
+//
+// The elements of all tuples are stored in one contiguous arena and the ids
+// in an open-addressing hash table with linear probing.
+template <class T>
+class TupleMap {
+public:
+    // Returns the id of the tuple and whether it has been inserted.
+    std::pair<size_t, bool> insert(T const *begin, size_t size) {
+        if ((offsets_.size() + 1) * 4 > table_.size() * 3) { rehash(std::max(size_t(16), 2 * table_.size())); }
+        size_t hash = hashTuple(begin, size);
+        size_t mask = table_.size() - 1;
+        size_t i = hash & mask;
+        for (; table_[i] != 0; i = (i + 1) & mask) {
+            size_t id = table_[i] - 1;
+            auto tuple = at(id);
+            if (hashes_[id] == hash && tuple.size == size && std::equal(begin, begin + size, tuple.first)) {
+                return {id, false};
+            }
+        }
+        size_t id = this->size();
+        arena_.insert(arena_.end(), begin, begin + size);
+        offsets_.emplace_back(arena_.size());
+        hashes_.emplace_back(hash);
+        table_[i] = id + 1;
+        return {id, true};
+    }
+    Potassco::Span<T> at(size_t id) const {
+        return {arena_.data() + offsets_[id], offsets_[id + 1] - offsets_[id]};
+    }
+    size_t size() const {
+        return offsets_.size() - 1;
+    }
+
+private:
+    static size_t hashTuple(T const *begin, size_t size) {
+        size_t hash = size;
+        for (auto it = begin, ie = begin + size; it != ie; ++it) {
+            hash ^= Hash<T>()(*it) + 0x9e3779b9 + (hash<<6) + (hash>>2);
+        }
+        return hash;
+    }
+    void rehash(size_t capacity) {
+        std::vector<size_t> table(capacity, 0);
+        size_t mask = capacity - 1;
+        for (size_t id = 0, ie = size(); id != ie; ++id) {
+            size_t i = hashes_[id] & mask;
+            while (table[i] != 0) { i = (i + 1) & mask; }
+            table[i] = id + 1;
+        }
+        table_ = std::move(table);
+    }
+
+    std::vector<T> arena_;
+    std::vector<size_t> offsets_ = {0};
+    std::vector<size_t> hashes_;
+    // ids plus one; zero marks empty slots
+    std::vector<size_t> table_;
+};
+
 } // namespace Reify
 
 #endif // UTIL_PROGRAM_HH
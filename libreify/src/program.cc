@@ -26,15 +26,253 @@
 #include "gringo/symbol.hh"
 #include <iostream>
 #include <algorithm>
-#include <sstream>
+#include <tuple>
+#include <type_traits>
 #include <cassert>
 
 namespace Reify {
 
+// {{{1 FactSink
+
+FactSink::~FactSink() noexcept = default;
+
+// {{{1 StreamSink
+
+StreamSink::StreamSink(std::ostream &out)
+: out_(out) { }
+
+void StreamSink::separate() {
+    if (sep_) { out_ << ","; }
+    sep_ = true;
+}
+
+void StreamSink::beginFact(char const *name) {
+    out_ << name << "(";
+    sep_ = false;
+}
+
+void StreamSink::beginFunction(char const *name) {
+    separate();
+    out_ << name << "(";
+    sep_ = false;
+}
+
+void StreamSink::endFunction() {
+    out_ << ")";
+    sep_ = true;
+}
+
+void StreamSink::number(int num) {
+    separate();
+    out_ << num;
+}
+
+void StreamSink::identifier(char const *name) {
+    separate();
+    out_ << name;
+}
+
+void StreamSink::string(StringSpan const &str) {
+    separate();
+    out_ << '"' << Gringo::quote(str) << '"';
+}
+
+void StreamSink::term(StringSpan const &str) {
+    separate();
+    out_ << str;
+}
+
+void StreamSink::endFact() {
+    out_ << ").\n";
+}
+
+// {{{1 SCCGraph
+
+uint32_t SCCGraph::addNode(Atom_t atom) {
+    auto ret = nodes_.emplace(atom, static_cast<uint32_t>(atoms_.size()));
+    if (ret.second) {
+        uint32_t node = ret.first->second;
+        atoms_.emplace_back(atom);
+        edges_.emplace_back();
+        parent_.emplace_back(node);
+        next_.emplace_back(node);
+        source_.emplace_back(false);
+        index_.emplace_back(0);
+        lowlink_.emplace_back(0);
+        visited_.emplace_back(0);
+        onStack_.emplace_back(false);
+    }
+    return ret.first->second;
+}
+
+uint32_t SCCGraph::find(uint32_t node) {
+    while (parent_[node] != node) {
+        parent_[node] = parent_[parent_[node]];
+        node = parent_[node];
+    }
+    return node;
+}
+
+void SCCGraph::addEdge(Atom_t u, Atom_t v) {
+    uint32_t x = addNode(u);
+    uint32_t y = addNode(v);
+    edges_[x].emplace_back(y);
+    if (!source_[x]) {
+        source_[x] = true;
+        sources_.emplace_back(x);
+    }
+}
+
+void SCCGraph::visit(uint32_t node) {
+    visited_[node] = stamp_;
+    index_[node] = lowlink_[node] = count_++;
+    stack_.emplace_back(node);
+    onStack_[node] = true;
+    frames_.push_back({node, node, 0});
+}
+
+SCCGraph::SCCVec SCCGraph::update() {
+    SCCVec sccs;
+    ++stamp_;
+    count_ = 0;
+    for (auto &source : sources_) {
+        source_[source] = false;
+        uint32_t root = find(source);
+        if (visited_[root] == stamp_) { continue; }
+        visit(root);
+        while (!frames_.empty()) {
+            // advance to the next unvisited successor of the component
+            bool descend = false;
+            for (;;) {
+                auto &frame = frames_.back();
+                auto &edges = edges_[frame.member];
+                if (frame.edge < edges.size()) {
+                    uint32_t succ = find(edges[frame.edge++]);
+                    if (succ == frame.rep) { continue; }
+                    if (visited_[succ] != stamp_) {
+                        visit(succ);
+                        descend = true;
+                        break;
+                    }
+                    if (onStack_[succ]) { lowlink_[frame.rep] = std::min(lowlink_[frame.rep], index_[succ]); }
+                }
+                else {
+                    frame.member = next_[frame.member];
+                    frame.edge = 0;
+                    if (frame.member == frame.rep) { break; }
+                }
+            }
+            if (descend) { continue; }
+            uint32_t rep = frames_.back().rep;
+            frames_.pop_back();
+            if (!frames_.empty()) {
+                auto &parent = frames_.back().rep;
+                lowlink_[parent] = std::min(lowlink_[parent], lowlink_[rep]);
+            }
+            if (lowlink_[rep] == index_[rep]) {
+                // merge the components on the stack into rep
+                bool merged = false;
+                for (;;) {
+                    uint32_t node = stack_.back();
+                    stack_.pop_back();
+                    onStack_[node] = false;
+                    if (node == rep) { break; }
+                    parent_[node] = rep;
+                    std::swap(next_[rep], next_[node]);
+                    merged = true;
+                }
+                if (merged) {
+                    sccs.emplace_back();
+                    uint32_t node = rep;
+                    do {
+                        sccs.back().emplace_back(atoms_[node]);
+                        node = next_[node];
+                    }
+                    while (node != rep);
+                    std::sort(sccs.back().begin(), sccs.back().end());
+                }
+            }
+        }
+    }
+    sources_.clear();
+    return sccs;
+}
+
 // {{{1 Reifier
 
+namespace {
+
+struct String {
+    StringSpan str;
+};
+
+template <class... T>
+struct Function {
+    char const *name;
+    std::tuple<T const &...> args;
+};
+
+template <class... T>
+Function<T...> function(char const *name, T const &...args) {
+    return {name, std::tuple<T const &...>(args...)};
+}
+
+template <class T>
+typename std::enable_if<std::is_integral<T>::value>::type printArg(FactSink &sink, T num) {
+    sink.number(static_cast<int>(num));
+}
+
+void printArg(FactSink &sink, char const *name) {
+    sink.identifier(name);
+}
+
+void printArg(FactSink &sink, String const &str) {
+    sink.string(str.str);
+}
+
+void printArg(FactSink &sink, StringSpan const &str) {
+    sink.term(str);
+}
+
+template <class T, class U>
+void printArg(FactSink &sink, std::pair<T, U> const &pair) {
+    printArg(sink, pair.first);
+    printArg(sink, pair.second);
+}
+
+inline void printArgs(FactSink &) { }
+
+template <class T, class... U>
+void printArgs(FactSink &sink, T const &arg, U const &...args);
+
+template <class... T, size_t... I>
+void printFunArgs(FactSink &sink, std::tuple<T const &...> const &args, std::index_sequence<I...>) {
+    printArgs(sink, std::get<I>(args)...);
+}
+
+template <class... T>
+void printArg(FactSink &sink, Function<T...> const &fun) {
+    sink.beginFunction(fun.name);
+    printFunArgs(sink, fun.args, std::index_sequence_for<T...>());
+    sink.endFunction();
+}
+
+template <class T, class... U>
+void printArgs(FactSink &sink, T const &arg, U const &...args) {
+    printArg(sink, arg);
+    printArgs(sink, args...);
+}
+
+} // namespace
+
 Reifier::Reifier(std::ostream &out, bool calculateSCCs, bool reifyStep)
-: out_(out)
+: stream_(gringo_make_unique<StreamSink>(out))
+, sink_(*stream_)
+, calculateSCCs_(calculateSCCs)
+, reifyStep_(reifyStep) { }
+
+Reifier::Reifier(FactSink &sink, bool calculateSCCs, bool reifyStep)
+: sink_(sink)
 , calculateSCCs_(calculateSCCs)
 , reifyStep_(reifyStep) { }
 
@@ -42,9 +280,9 @@ Reifier::~Reifier() noexcept = default;
 
 template<typename... T>
 void Reifier::printFact(char const *name, T const &...args) {
-    out_ << name << "(";
-    printComma(out_, args...);
-    out_ << ").\n";
+    sink_.beginFact(name);
+    printArgs(sink_, args...);
+    sink_.endFact();
 }
 template<typename... T>
 void Reifier::printStepFact(char const *name, T const &...args) {
@@ -52,40 +290,30 @@ void Reifier::printStepFact(char const *name, T const &...args) {
     else            { printFact(name, args...); }
 }
 
-template <class M, class T>
-size_t Reifier::tuple(M &map, char const *name, T const &args) {
-    return tuple(map, name, toVec(args));
-}
-
-template <class M, class T>
-size_t Reifier::tuple(M &map, char const *name, std::vector<T> &&args) {
-    auto ret = map.emplace(std::move(args), map.size());
+template <class T>
+size_t Reifier::tuple(TupleMap<T> &map, char const *name, Potassco::Span<T> const &args) {
+    auto ret = map.insert(args.first, args.size);
     if (ret.second) {
-        printStepFact(name, ret.first->second);
-        for (auto &x : ret.first->first) {
-            printStepFact(name, ret.first->second, x);
+        printStepFact(name, ret.first);
+        for (auto &x : map.at(ret.first)) {
+            printStepFact(name, ret.first, x);
         }
     }
-    return ret.first->second;
-}
-
-template <class M, class T>
-size_t Reifier::ordered_tuple(M &map, char const *name, T const &args) {
-    return ordered_tuple(map, name, toVec(args));
+    return ret.first;
 }
 
-template <class M, class T>
-size_t Reifier::ordered_tuple(M &map, char const *name, std::vector<T> &&args) {
-    auto ret = map.emplace(std::move(args), map.size());
+template <class T>
+size_t Reifier::ordered_tuple(TupleMap<T> &map, char const *name, Potassco::Span<T> const &args) {
+    auto ret = map.insert(args.first, args.size);
     if (ret.second) {
-        printStepFact(name, ret.first->second);
+        printStepFact(name, ret.first);
         int arg = 0;
-        for (auto &x : ret.first->first) {
-            printStepFact(name, ret.first->second, arg, x);
+        for (auto &x : map.at(ret.first)) {
+            printStepFact(name, ret.first, arg, x);
             ++arg;
         }
     }
-    return ret.first->second;
+    return ret.first;
 }
 
 size_t Reifier::theoryTuple(IdSpan const &args) {
@@ -101,22 +329,15 @@ size_t Reifier::litTuple(LitSpan const &args) {
 }
 
 size_t Reifier::weightLitTuple(WeightLitSpan const &args) {
-    WLVec lits;
-    lits.reserve(args.size);
-    for (auto &x : args) { lits.emplace_back(x.lit, x.weight); }
-    return tuple(stepData_.weightLitTuples, "weighted_literal_tuple", std::move(lits));
+    wlits_.clear();
+    for (auto &x : args) { wlits_.emplace_back(x.lit, x.weight); }
+    return tuple(stepData_.weightLitTuples, "weighted_literal_tuple", Potassco::toSpan(wlits_));
 }
 
 size_t Reifier::atomTuple(AtomSpan const &args) {
     return tuple(stepData_.atomTuples, "atom_tuple", args);
 }
 
-Reifier::Graph::Node &Reifier::addNode(Atom_t atom) {
-    auto & node = stepData_.nodes_[atom];
-    if (!node) { node = &stepData_.graph_.insertNode(atom); }
-    return *node;
-}
-
 void Reifier::initProgram(bool incremental) {
     if (incremental) { printFact("tag", "incremental"); }
 }
@@ -125,30 +346,26 @@ void Reifier::beginStep() { }
 
 void Reifier::rule(Head_t ht, const AtomSpan& head, const LitSpan& body) {
     char const *h = ht == Potassco::Head_t::Disjunctive ? "disjunction" : "choice";
-    std::ostringstream hss, bss;
-    hss << h << "(" << atomTuple(head) << ")";
-    bss << "normal(" << litTuple(body) << ")";
-    printStepFact("rule", hss.str(), bss.str());
+    auto headId = atomTuple(head);
+    auto bodyId = litTuple(body);
+    printStepFact("rule", function(h, headId), function("normal", bodyId));
     if (calculateSCCs_) { calculateSCCs(head, body); }
 }
 
 void Reifier::rule(Head_t ht, const AtomSpan& head, Weight_t bound, const WeightLitSpan& body) {
     char const *h = ht == Potassco::Head_t::Disjunctive ? "disjunction" : "choice";
-    std::ostringstream hss, bss;
-    hss << h << "(" << atomTuple(head) << ")";
-    bss << "sum(" << weightLitTuple(body) << "," << bound << ")";
-    printStepFact("rule", hss.str(), bss.str());
+    auto headId = atomTuple(head);
+    auto bodyId = weightLitTuple(body);
+    printStepFact("rule", function(h, headId), function("sum", bodyId, bound));
     if (calculateSCCs_) { calculateSCCs(head, body); }
 }
 
 template <class L>
 void Reifier::calculateSCCs(const AtomSpan& head, const Potassco::Span<L>& body) {
     for (auto &atom : head) {
-        Graph::Node &u = addNode(atom);
         for (auto &elem : body) {
             if (Potassco::lit(elem) > 0) {
-                Graph::Node &v = addNode(Potassco::lit(elem));
-                u.insertEdge(v);
+                stepData_.graph_.addEdge(atom, Potassco::lit(elem));
             }
         }
     }
@@ -203,10 +420,7 @@ void Reifier::theoryTerm(Id_t termId, int number) {
 }
 
 void Reifier::theoryTerm(Id_t termId, const StringSpan& name) {
-    auto s = Gringo::quote(name);
-    s.insert(s.begin(), '"');
-    s.push_back('"');
-    printStepFact("theory_string", termId, s);
+    printStepFact("theory_string", termId, String{name});
 }
 
 void Reifier::theoryTerm(Id_t termId, int cId, IdSpan const &args) {
@@ -237,14 +451,11 @@ void Reifier::theoryAtom(Id_t atomOrZero, Id_t termId, IdSpan const &elements, I
 }
 
 void Reifier::endStep() {
-    size_t i = 0;
-    for (auto &scc : stepData_.graph_.tarjan()) {
-        if (scc.size() > 1) {
-            for (auto &node : scc) {
-                printStepFact("scc", i, node->data);
-            }
+    for (auto &scc : stepData_.graph_.update()) {
+        for (auto &atom : scc) {
+            printStepFact("scc", stepData_.sccs_, atom);
         }
-        ++i;
+        ++stepData_.sccs_;
     }
     if (reifyStep_) {
         stepData_ = StepData();
@@ -66,6 +66,40 @@ TEST_CASE("program", "[program]") {
         REQUIRE(read(input, output, true));
         REQUIRE(output.str() == result);
     }
+    SECTION("cycle_incremental") {
+        input << "#incremental."
+              << "a:-b."
+              << "c:-b."
+              << "#step."
+              << "b:-c."
+              << "#step."
+              << "b:-a.";
+        auto result =
+            "tag(incremental).\n"
+            "atom_tuple(0).\n"
+            "atom_tuple(0,1).\n"
+            "literal_tuple(0).\n"
+            "literal_tuple(0,2).\n"
+            "rule(disjunction(0),normal(0)).\n"
+            "atom_tuple(1).\n"
+            "atom_tuple(1,3).\n"
+            "rule(disjunction(1),normal(0)).\n"
+            "atom_tuple(2).\n"
+            "atom_tuple(2,2).\n"
+            "literal_tuple(1).\n"
+            "literal_tuple(1,3).\n"
+            "rule(disjunction(2),normal(1)).\n"
+            "scc(0,2).\n"
+            "scc(0,3).\n"
+            "literal_tuple(2).\n"
+            "literal_tuple(2,1).\n"
+            "rule(disjunction(2),normal(2)).\n"
+            "scc(1,1).\n"
+            "scc(1,2).\n"
+            "scc(1,3).\n";
+        REQUIRE(read(input, output, true));
+        REQUIRE(output.str() == result);
+    }
     SECTION("choice") {
         input << "{a, b}.";
         REQUIRE(read(input, output));